@@ -86,17 +86,19 @@ struct SDSPStream  {
 
       if (remFileBytes < halfSize) {
         // printf("Buffering %d from %d into %d\n", remFileBytes, xcc_fileCur + x10_info.x8_headerSize, buf);
-        m_file->AsyncSeekRead(data, remFileBytes, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize);
+        m_file->AsyncSeekRead(data, remFileBytes, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize, {},
+                              EDvdPriority::AudioStream);
         xcc_fileCur = x10_info.x14_loopStartByte;
         u32 remBytes = halfSize - remFileBytes;
         // printf("Loop Buffering %d from %d into %d\n", remBytes, xcc_fileCur + x10_info.x8_headerSize, buf);
         m_readReqs[buf] = m_file->AsyncSeekRead(data + remFileBytes, remBytes, ESeekOrigin::Begin,
-                                                xcc_fileCur + x10_info.x8_headerSize);
+                                                xcc_fileCur + x10_info.x8_headerSize, {}, EDvdPriority::AudioStream);
         xcc_fileCur += remBytes;
       } else {
         // printf("Buffering %d from %d into %d\n", halfSize, xcc_fileCur + x10_info.x8_headerSize, buf);
         m_readReqs[buf] =
-            m_file->AsyncSeekRead(data, halfSize, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize);
+            m_file->AsyncSeekRead(data, halfSize, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize, {},
+                                  EDvdPriority::AudioStream);
         xcc_fileCur += halfSize;
       }
     } else {
@@ -110,13 +112,15 @@ struct SDSPStream  {
       if (remFileBytes < halfSize) {
         // printf("Buffering %d from %d into %d\n", remFileBytes, xcc_fileCur + x10_info.x8_headerSize, buf);
         m_readReqs[buf] =
-            m_file->AsyncSeekRead(data, remFileBytes, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize);
+            m_file->AsyncSeekRead(data, remFileBytes, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize, {},
+                                  EDvdPriority::AudioStream);
         memset(data + remFileBytes, 0, halfSize - remFileBytes);
         xcc_fileCur = x10_info.xc_adpcmBytes;
       } else {
         // printf("Buffering %d from %d into %d\n", halfSize, xcc_fileCur + x10_info.x8_headerSize, buf);
         m_readReqs[buf] =
-            m_file->AsyncSeekRead(data, halfSize, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize);
+            m_file->AsyncSeekRead(data, halfSize, ESeekOrigin::Begin, xcc_fileCur + x10_info.x8_headerSize, {},
+                                  EDvdPriority::AudioStream);
         xcc_fileCur += halfSize;
       }
     }
@@ -662,7 +666,7 @@ public:
       return false;
 
     stream.x70_26_headerReadState = 1;
-    stream.m_dvdReq = file.AsyncRead(&stream.x0_header, sizeof(dspadpcm_header));
+    stream.m_dvdReq = file.AsyncRead(&stream.x0_header, sizeof(dspadpcm_header), {}, EDvdPriority::AudioStream);
     return true;
   }
 
@@ -682,8 +686,8 @@ public:
     lstream.x70_26_headerReadState = 1;
     rstream.x70_26_headerReadState = 1;
 
-    lstream.m_dvdReq = lfile.AsyncRead(&lstream.x0_header, sizeof(dspadpcm_header));
-    rstream.m_dvdReq = rfile.AsyncRead(&rstream.x0_header, sizeof(dspadpcm_header));
+    lstream.m_dvdReq = lfile.AsyncRead(&lstream.x0_header, sizeof(dspadpcm_header), {}, EDvdPriority::AudioStream);
+    rstream.m_dvdReq = rfile.AsyncRead(&rstream.x0_header, sizeof(dspadpcm_header), {}, EDvdPriority::AudioStream);
     return true;
   }
 
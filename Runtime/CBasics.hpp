@@ -69,6 +69,9 @@ public:
   static bool IsDir(const char* path);
   static bool IsFile(const char* path);
   static int Stat(const char* path, Sstat* statOut);
+  /* Maps an entire file read-only; returns nullptr on failure or when the platform lacks support */
+  static const u8* MapFileReadOnly(const char* path, u64& sizeOut);
+  static void UnmapFile(const u8* ptr, u64 size);
 };
 
 } // namespace metaforce
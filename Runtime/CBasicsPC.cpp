@@ -1,4 +1,7 @@
 #ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <unistd.h>
 #if __APPLE__
@@ -248,6 +251,66 @@ int CBasics::Stat(const char* path, Sstat* statOut) {
 #endif
 }
 
+const u8* CBasics::MapFileReadOnly(const char* path, u64& sizeOut) {
+  sizeOut = 0;
+#if _WIN32
+  const nowide::wstackstring wpath(path);
+  HANDLE file = CreateFileW(wpath.get(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    CloseHandle(file);
+    return nullptr;
+  }
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+  /* The view keeps the mapping object alive */
+  const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (view == nullptr) {
+    return nullptr;
+  }
+  sizeOut = u64(size.QuadPart);
+  return static_cast<const u8*>(view);
+#elif defined(EMSCRIPTEN)
+  return nullptr;
+#else
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  void* ptr = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+  sizeOut = u64(st.st_size);
+  return static_cast<const u8*>(ptr);
+#endif
+}
+
+void CBasics::UnmapFile(const u8* ptr, u64 size) {
+  if (ptr == nullptr) {
+    return;
+  }
+#if _WIN32
+  UnmapViewOfFile(ptr);
+#elif !defined(EMSCRIPTEN)
+  munmap(const_cast<u8*>(ptr), size_t(size));
+#endif
+}
+
 /* recursive mkdir */
 int CBasics::RecursiveMakeDir(const char* dir) {
 #if _WIN32
@@ -1,25 +1,64 @@
 #include "Runtime/CDvdFile.hpp"
 
+#include <optional>
+
 #include <optick.h>
 
+#include "Runtime/CBasics.hpp"
 #include "Runtime/CDvdRequest.hpp"
 #include "Runtime/CStopwatch.hpp"
 
 namespace metaforce {
 
 std::unique_ptr<nod::DiscBase> CDvdFile::m_DvdRoot;
-// std::unordered_map<std::string, std::string> CDvdFile::m_caseInsensitiveMap;
+std::unordered_multimap<u64, std::pair<std::string, nod::Node*>> CDvdFile::m_caseInsensitiveMap;
+
+namespace {
+constexpr u64 kFNVOffsetBasis = 0xcbf29ce484222325ull;
+constexpr u64 kFNVPrime = 0x100000001b3ull;
+
+constexpr char FoldCase(char c) { return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c; }
+
+constexpr u64 HashFolded(std::string_view str, u64 hash = kFNVOffsetBasis) {
+  for (const char c : str) {
+    hash = (hash ^ u8(FoldCase(c))) * kFNVPrime;
+  }
+  return hash;
+}
+
+/* Compares an already folded key against prefix + '/' + path (prefix may be empty) */
+bool FoldedKeyEquals(std::string_view key, std::string_view prefix, std::string_view path) {
+  if (!prefix.empty()) {
+    if (key.size() != prefix.size() + 1 + path.size() || key[prefix.size()] != '/') {
+      return false;
+    }
+  } else if (key.size() != path.size()) {
+    return false;
+  }
+  const auto equalFolded = [](char a, char b) { return a == FoldCase(b); };
+  const size_t pathStart = prefix.empty() ? 0 : prefix.size() + 1;
+  return std::equal(prefix.begin(), prefix.end(), key.begin(), equalFolded) &&
+         std::equal(path.begin(), path.end(), key.begin() + std::ptrdiff_t(pathStart), equalFolded);
+}
+} // namespace
 
 class CFileDvdRequest : public IDvdRequest {
+  friend class CDvdFile;
+  using Clock = std::chrono::steady_clock;
+
   std::shared_ptr<nod::IPartReadStream> m_reader;
-  uint64_t m_begin;
-  uint64_t m_size;
+  uint64_t m_offset;
 
   void* m_buf;
   u32 m_len;
-  ESeekOrigin m_whence;
-  int m_offset;
+  EDvdPriority m_priority;
+  Clock::time_point m_submitTime;
+  Clock::time_point m_deadline;
 
+  /* Held while the reader thread writes into m_buf, so a cancel never returns mid-read */
+  std::mutex m_serviceMutex;
+  std::condition_variable m_completeCV;
+  std::vector<std::function<void()>> m_continuations;
 #ifdef HAS_DVD_THREAD
   std::atomic_bool m_cancel = {false};
   std::atomic_bool m_complete = {false};
@@ -34,9 +73,8 @@ public:
 
   void WaitUntilComplete() override {
 #ifdef HAS_DVD_THREAD
-    while (!m_complete.load() && !m_cancel.load()) {
-      std::unique_lock lk{CDvdFile::m_WaitMutex};
-    }
+    std::unique_lock lk{m_serviceMutex};
+    m_completeCV.wait(lk, [this]() { return m_complete.load() || m_cancel.load(); });
 #else
     if (!m_complete && !m_cancel) {
       CDvdFile::DoWork();
@@ -58,60 +96,65 @@ public:
     if (m_complete.load() || m_cancel.load()) {
       return;
     }
-    std::unique_lock waitlk{CDvdFile::m_WaitMutex};
+    std::unique_lock lk{m_serviceMutex};
     m_cancel.store(true);
+    m_continuations.clear();
+    lk.unlock();
+    m_completeCV.notify_all();
 #else
     m_cancel = true;
+    m_continuations.clear();
+#endif
+  }
+  void ContinueWith(std::function<void()>&& cb) override {
+    std::unique_lock lk{m_serviceMutex};
+    if (IsCancelled()) {
+      return;
+    }
+#ifdef HAS_DVD_THREAD
+    if (!m_complete.load()) {
+#else
+    if (!m_complete) {
 #endif
+      m_continuations.push_back(std::move(cb));
+      return;
+    }
+    lk.unlock();
+    cb();
   }
 
   [[nodiscard]] EMediaType GetMediaType() const override { return EMediaType::File; }
 
-  CFileDvdRequest(CDvdFile& file, void* buf, u32 len, ESeekOrigin whence, int off, std::function<void(u32)>&& cb)
+  CFileDvdRequest(CDvdFile& file, void* buf, u32 len, uint64_t offset, EDvdPriority prio,
+                  std::chrono::milliseconds deadline, std::function<void(u32)>&& cb)
   : m_reader(file.m_reader)
-  , m_begin(file.m_begin)
-  , m_size(file.m_size)
+  , m_offset(offset)
   , m_buf(buf)
   , m_len(len)
-  , m_whence(whence)
-  , m_offset(off)
+  , m_priority(prio)
+  , m_submitTime(Clock::now())
+  , m_deadline(m_submitTime + deadline)
   , m_callback(std::move(cb)) {}
 
-  void DoRequest() {
+  [[nodiscard]] bool IsCancelled() const {
 #ifdef HAS_DVD_THREAD
-    if (m_cancel.load()) {
-      return;
-    }
+    return m_cancel.load();
 #else
-    if (m_cancel) {
-      return;
-    }
+    return m_cancel;
 #endif
-    u32 readLen = 0;
-    if (m_whence == ESeekOrigin::Cur && m_offset == 0) {
-      readLen = m_reader->read(m_buf, m_len);
-    } else {
-      int seek = 0;
-      int64_t offset = m_offset;
-      switch (m_whence) {
-      case ESeekOrigin::Begin: {
-        seek = SEEK_SET;
-        offset += int64_t(m_begin);
-        break;
-      }
-      case ESeekOrigin::End: {
-        seek = SEEK_SET;
-        offset += int64_t(m_begin) + int64_t(m_size);
-        break;
-      }
-      case ESeekOrigin::Cur: {
-        seek = SEEK_CUR;
-        break;
-      }
-      };
-      m_reader->seek(offset, seek);
-      readLen = m_reader->read(m_buf, m_len);
+  }
+  [[nodiscard]] uint64_t GetEndOffset() const { return m_offset + m_len; }
+
+  bool DoRequest() {
+    std::unique_lock lk{m_serviceMutex};
+    if (IsCancelled()) {
+      return false;
     }
+    /* Coalesced requests continue where the previous read left off without seeking */
+    if (m_reader->position() != m_offset) {
+      m_reader->seek(int64_t(m_offset), SEEK_SET);
+    }
+    const u32 readLen = m_reader->read(m_buf, m_len);
     if (m_callback) {
       m_callback(readLen);
     }
@@ -120,19 +163,35 @@ public:
 #else
     m_complete = true;
 #endif
+    auto continuations = std::move(m_continuations);
+    m_continuations.clear();
+    lk.unlock();
+    m_completeCV.notify_all();
+    for (auto& cont : continuations) {
+      cont();
+    }
+    return true;
   }
 };
 
 #ifdef HAS_DVD_THREAD
-std::thread CDvdFile::m_WorkerThread;
-std::mutex CDvdFile::m_WorkerMutex;
+std::vector<std::thread> CDvdFile::m_WorkerThreads;
 std::condition_variable CDvdFile::m_WorkerCV;
-std::mutex CDvdFile::m_WaitMutex;
 std::atomic_bool CDvdFile::m_WorkerRun = {false};
 #endif
-std::vector<std::shared_ptr<IDvdRequest>> CDvdFile::m_RequestQueue;
+std::mutex CDvdFile::m_WorkerMutex;
+u32 CDvdFile::m_ReaderThreadCount = 2;
+std::array<std::vector<std::shared_ptr<CFileDvdRequest>>, kNumDvdPriorities> CDvdFile::m_RequestQueues;
+std::array<SDvdQueueStats, kNumDvdPriorities> CDvdFile::m_QueueStats;
+std::vector<const nod::IPartReadStream*> CDvdFile::m_BusyReaders;
 std::string CDvdFile::m_rootDirectory;
 std::unique_ptr<u8[]> CDvdFile::m_dolBuf;
+bool CDvdFile::m_MemoryMapEnabled = true;
+const u8* CDvdFile::m_MappedImage = nullptr;
+u64 CDvdFile::m_MappedImageSize = 0;
+
+/* Upper bound on bytes merged into one sequential batch, keeps urgent classes responsive */
+constexpr u64 kMaxCoalesceBytes = 1024 * 1024;
 
 CDvdFile::CDvdFile(std::string_view path) : x18_path(path) {
   auto* node = ResolvePath(path);
@@ -143,79 +202,261 @@ CDvdFile::CDvdFile(std::string_view path) : x18_path(path) {
   }
 }
 
-// single-threaded hack
-void CDvdFile::DoWork() {
-  for (std::shared_ptr<IDvdRequest>& req : m_RequestQueue) {
-    auto& concreteReq = static_cast<CFileDvdRequest&>(*req);
-    concreteReq.DoRequest();
+std::chrono::milliseconds CDvdFile::GetDefaultDeadline(EDvdPriority prio) {
+  switch (prio) {
+  case EDvdPriority::AudioStream:
+    return std::chrono::milliseconds{30};
+  case EDvdPriority::Foreground:
+    return std::chrono::milliseconds{200};
+  case EDvdPriority::AreaPrefetch:
+    return std::chrono::milliseconds{2000};
+  default:
+    return std::chrono::milliseconds{10000};
   }
-  m_RequestQueue.clear();
 }
 
-void CDvdFile::WorkerProc() {
-#ifdef HAS_DVD_THREAD
-  logvisor::RegisterThreadName("CDvdFile");
-  OPTICK_THREAD("CDvdFile");
+SDvdQueueStats CDvdFile::GetQueueStats(EDvdPriority prio) {
+  std::unique_lock lk{m_WorkerMutex};
+  return m_QueueStats[size_t(prio)];
+}
 
-  while (m_WorkerRun.load()) {
+void CDvdFile::EnqueueRequest(std::shared_ptr<CFileDvdRequest>&& req) {
+  {
+    const size_t prio = size_t(req->m_priority);
     std::unique_lock lk{m_WorkerMutex};
-    while (!m_RequestQueue.empty()) {
-      std::vector<std::shared_ptr<IDvdRequest>> swapQueue;
-      swapQueue.swap(m_RequestQueue);
-      lk.unlock();
-      std::unique_lock waitlk{m_WaitMutex};
-      for (std::shared_ptr<IDvdRequest>& req : swapQueue) {
-        auto& concreteReq = static_cast<CFileDvdRequest&>(*req);
-        concreteReq.DoRequest();
+    auto& queue = m_RequestQueues[prio];
+    /* Keep each class sorted by (reader, offset) so adjacent reads end up next to each other */
+    const auto it = std::upper_bound(queue.begin(), queue.end(), req, [](const auto& a, const auto& b) {
+      if (a->m_reader.get() != b->m_reader.get()) {
+        return std::less<>{}(a->m_reader.get(), b->m_reader.get());
+      }
+      return a->m_offset < b->m_offset;
+    });
+    queue.insert(it, std::move(req));
+    ++m_QueueStats[prio].queueDepth;
+  }
+#ifdef HAS_DVD_THREAD
+  m_WorkerCV.notify_one();
+#endif
+}
+
+bool CDvdFile::PopRequestBatch(std::vector<std::shared_ptr<CFileDvdRequest>>& batchOut,
+                               const nod::IPartReadStream* lastReader, u64 lastEnd) {
+  /* Caller holds m_WorkerMutex */
+  const auto now = CFileDvdRequest::Clock::now();
+  const auto isBusy = [](const nod::IPartReadStream* reader) {
+    return std::find(m_BusyReaders.cbegin(), m_BusyReaders.cend(), reader) != m_BusyReaders.cend();
+  };
+
+  for (size_t p = 0; p < kNumDvdPriorities; ++p) {
+    m_QueueStats[p].queueDepth -= u32(std::erase_if(m_RequestQueues[p], [](const auto& req) {
+      return req->IsCancelled();
+    }));
+  }
+
+  /* Overdue requests of any class go first, earliest deadline wins */
+  size_t bestQueue = 0;
+  std::optional<size_t> bestIdx;
+  for (size_t p = 0; p < kNumDvdPriorities; ++p) {
+    const auto& queue = m_RequestQueues[p];
+    for (size_t i = 0; i < queue.size(); ++i) {
+      const auto& req = queue[i];
+      if (req->m_deadline > now || isBusy(req->m_reader.get())) {
+        continue;
+      }
+      if (!bestIdx || req->m_deadline < m_RequestQueues[bestQueue][*bestIdx]->m_deadline) {
+        bestQueue = p;
+        bestIdx = i;
       }
-      waitlk.unlock();
-      swapQueue.clear();
-      lk.lock();
     }
-    if (!m_WorkerRun.load()) {
-      break;
+  }
+
+  /* Otherwise take the highest class, continuing forward on the reader this thread just used */
+  for (size_t p = 0; !bestIdx && p < kNumDvdPriorities; ++p) {
+    const auto& queue = m_RequestQueues[p];
+    std::optional<size_t> firstFree;
+    for (size_t i = 0; i < queue.size(); ++i) {
+      const auto& req = queue[i];
+      if (isBusy(req->m_reader.get())) {
+        continue;
+      }
+      if (req->m_reader.get() == lastReader && req->m_offset >= lastEnd) {
+        bestIdx = i;
+        break;
+      }
+      if (!firstFree) {
+        firstFree = i;
+      }
+    }
+    if (!bestIdx) {
+      bestIdx = firstFree;
     }
-    m_WorkerCV.wait(lk);
+    bestQueue = p;
   }
-#endif
+
+  if (!bestIdx) {
+    return false;
+  }
+
+  auto& queue = m_RequestQueues[bestQueue];
+  size_t endIdx = *bestIdx + 1;
+  u64 batchBytes = queue[*bestIdx]->m_len;
+  while (endIdx < queue.size() && batchBytes < kMaxCoalesceBytes &&
+         queue[endIdx]->m_reader == queue[endIdx - 1]->m_reader &&
+         queue[endIdx]->m_offset == queue[endIdx - 1]->GetEndOffset()) {
+    batchBytes += queue[endIdx]->m_len;
+    ++endIdx;
+  }
+
+  const auto first = queue.begin() + std::ptrdiff_t(*bestIdx);
+  const auto last = queue.begin() + std::ptrdiff_t(endIdx);
+  batchOut.insert(batchOut.end(), std::make_move_iterator(first), std::make_move_iterator(last));
+  queue.erase(first, last);
+
+  auto& stats = m_QueueStats[bestQueue];
+  stats.queueDepth -= u32(batchOut.size());
+  stats.coalescedCount += batchOut.size() - 1;
+  m_BusyReaders.push_back(batchOut.front()->m_reader.get());
+  return true;
 }
 
-std::shared_ptr<IDvdRequest> CDvdFile::AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
-                                                     std::function<void(u32)>&& cb) {
-  std::shared_ptr<IDvdRequest> ret = std::make_shared<CFileDvdRequest>(*this, buf, len, whence, off, std::move(cb));
+void CDvdFile::ServiceRequestBatch(std::vector<std::shared_ptr<CFileDvdRequest>>& batch) {
+  OPTICK_EVENT();
+  for (auto& req : batch) {
+    req->DoRequest();
+  }
+
+  const auto now = CFileDvdRequest::Clock::now();
+  {
+    std::unique_lock lk{m_WorkerMutex};
+    for (const auto& req : batch) {
+      auto& stats = m_QueueStats[size_t(req->m_priority)];
+      const float latencyMs = std::chrono::duration<float, std::milli>(now - req->m_submitTime).count();
+      stats.avgLatencyMs = stats.completedCount == 0 ? latencyMs : stats.avgLatencyMs * 0.9f + latencyMs * 0.1f;
+      stats.maxLatencyMs = std::max(stats.maxLatencyMs, latencyMs);
+      ++stats.completedCount;
+    }
+    std::erase(m_BusyReaders, batch.front()->m_reader.get());
+  }
 #ifdef HAS_DVD_THREAD
-  std::unique_lock lk{m_WorkerMutex};
+  /* Requests waiting on this reader may now be picked up */
+  m_WorkerCV.notify_all();
 #endif
-  m_RequestQueue.emplace_back(ret);
+  batch.clear();
+}
+
+// single-threaded hack
+void CDvdFile::DoWork() {
+  std::vector<std::shared_ptr<CFileDvdRequest>> batch;
+  const nod::IPartReadStream* lastReader = nullptr;
+  u64 lastEnd = 0;
+  while (true) {
+    {
+      std::unique_lock lk{m_WorkerMutex};
+      if (!PopRequestBatch(batch, lastReader, lastEnd)) {
+        break;
+      }
+    }
+    lastReader = batch.front()->m_reader.get();
+    lastEnd = batch.back()->GetEndOffset();
+    ServiceRequestBatch(batch);
+  }
+}
+
+void CDvdFile::WorkerProc(u32 idx) {
 #ifdef HAS_DVD_THREAD
-  lk.unlock();
-  m_WorkerCV.notify_one();
+  const std::string threadName = fmt::format(FMT_STRING("CDvdFile {}"), idx);
+  logvisor::RegisterThreadName(threadName.c_str());
+  OPTICK_THREAD(threadName.c_str());
+
+  std::vector<std::shared_ptr<CFileDvdRequest>> batch;
+  const nod::IPartReadStream* lastReader = nullptr;
+  u64 lastEnd = 0;
+  std::unique_lock lk{m_WorkerMutex};
+  while (m_WorkerRun.load()) {
+    if (!PopRequestBatch(batch, lastReader, lastEnd)) {
+      m_WorkerCV.wait(lk);
+      continue;
+    }
+    lastReader = batch.front()->m_reader.get();
+    lastEnd = batch.back()->GetEndOffset();
+    lk.unlock();
+    ServiceRequestBatch(batch);
+    lk.lock();
+  }
 #endif
-  return ret;
 }
 
-u32 CDvdFile::SyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int offset) {
-  int seek = 0;
+uint64_t CDvdFile::ResolveReadOffset(ESeekOrigin whence, int off, u32 len) {
+  int64_t pos = off;
   switch (whence) {
-  case ESeekOrigin::Begin: {
-    seek = SEEK_SET;
-    offset += int64_t(m_begin);
+  case ESeekOrigin::Begin:
     break;
-  }
-  case ESeekOrigin::End: {
-    seek = SEEK_SET;
-    offset += int64_t(m_begin) + int64_t(m_size);
+  case ESeekOrigin::End:
+    pos += int64_t(m_size);
     break;
-  }
-  case ESeekOrigin::Cur: {
-    seek = SEEK_CUR;
+  case ESeekOrigin::Cur:
+    pos += int64_t(m_filePos);
     break;
   }
-  };
-  m_reader->seek(offset, seek);
+  m_filePos = uint64_t(pos) + len;
+  return m_begin + uint64_t(pos);
+}
+
+std::shared_ptr<IDvdRequest> CDvdFile::AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
+                                                     std::function<void(u32)>&& cb, EDvdPriority prio) {
+  return AsyncSeekRead(buf, len, whence, off, prio, GetDefaultDeadline(prio), std::move(cb));
+}
+
+std::shared_ptr<IDvdRequest> CDvdFile::AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
+                                                     EDvdPriority prio, std::chrono::milliseconds deadline,
+                                                     std::function<void(u32)>&& cb) {
+  auto req = std::make_shared<CFileDvdRequest>(*this, buf, len, ResolveReadOffset(whence, off, len), prio, deadline,
+                                               std::move(cb));
+  std::shared_ptr<IDvdRequest> ret = req;
+  EnqueueRequest(std::move(req));
+  return ret;
+}
+
+u32 CDvdFile::SyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int offset) {
+  m_reader->seek(int64_t(ResolveReadOffset(whence, offset, len)), SEEK_SET);
   return m_reader->read(buf, len);
 }
 
+std::span<const u8> CDvdFile::GetMappedRange(u32 off, u32 len) const {
+  if (m_MappedImage == nullptr || !m_reader || u64(off) + len > m_size) {
+    return {};
+  }
+  const u64 begin = m_begin + off;
+  if (begin + len > m_MappedImageSize) {
+    return {};
+  }
+  return {m_MappedImage + begin, len};
+}
+
+void CDvdFile::MapDiscImage(std::string_view path) {
+  u64 size = 0;
+  const u8* image = CBasics::MapFileReadOnly(std::string(path).c_str(), size);
+  if (image == nullptr) {
+    return;
+  }
+  /* Only raw GameCube images map 1:1 onto data partition offsets; Wii partitions are
+   * encrypted and compressed containers (CISO, WBFS, RVZ, ...) lack the magic at 0x1C */
+  constexpr u32 GCNDiscMagic = 0xC2339F3D;
+  const auto& header = m_DvdRoot->getHeader();
+  u32 magic = 0;
+  if (size >= 0x20) {
+    std::memcpy(&magic, image + 0x1C, sizeof(magic));
+    magic = CBasics::SwapBytes(magic);
+  }
+  if (magic != GCNDiscMagic || std::memcmp(image, header.m_gameID, sizeof(header.m_gameID)) != 0) {
+    CBasics::UnmapFile(image, size);
+    return;
+  }
+  m_MappedImage = image;
+  m_MappedImageSize = size;
+}
+
 nod::Node* CDvdFile::ResolvePath(std::string_view path) {
   if (!m_DvdRoot) {
     return nullptr;
@@ -223,37 +464,45 @@ nod::Node* CDvdFile::ResolvePath(std::string_view path) {
   if (path.starts_with('/')) {
     path.remove_prefix(1);
   }
-  std::string prefixedPath;
-  if (!m_rootDirectory.empty()) {
-    prefixedPath = m_rootDirectory;
-    prefixedPath += '/';
-    prefixedPath += path;
-    path = prefixedPath;
-  }
-  auto* node = &m_DvdRoot->getDataPartition()->getFSTRoot();
-  while (node != nullptr && !path.empty()) {
-    std::string component;
-    auto end = path.find('/');
-    if (end != std::string_view::npos) {
-      component = path.substr(0, end);
-      path.remove_prefix(component.size() + 1);
-    } else {
-      component = path;
-      path.remove_prefix(component.size());
+  while (path.ends_with('/')) {
+    path.remove_suffix(1);
+  }
+  std::string_view prefix = m_rootDirectory;
+  if (path.empty()) {
+    std::swap(prefix, path);
+  }
+  if (path.empty()) {
+    return &m_DvdRoot->getDataPartition()->getFSTRoot();
+  }
+  u64 hash = HashFolded(prefix);
+  if (!prefix.empty()) {
+    hash = HashFolded("/", hash);
+  }
+  hash = HashFolded(path, hash);
+  const auto [begin, end] = m_caseInsensitiveMap.equal_range(hash);
+  for (auto it = begin; it != end; ++it) {
+    if (FoldedKeyEquals(it->second.first, prefix, path)) {
+      return it->second.second;
     }
-    std::transform(component.begin(), component.end(), component.begin(), ::tolower);
-    auto* tmpNode = node;
-    node = nullptr;
-    for (auto& item : *tmpNode) {
-      const auto name = item.getName();
-      if (std::equal(component.begin(), component.end(), name.begin(), name.end(),
-                     [](char a, char b) { return a == tolower(b); })) {
-        node = &item;
-        break;
-      }
+  }
+  return nullptr;
+}
+
+void CDvdFile::RecursiveBuildCaseInsensitiveMap(nod::Node& dir, std::string& prefix) {
+  for (auto& item : dir) {
+    const size_t prefixLen = prefix.size();
+    if (prefixLen != 0) {
+      prefix += '/';
     }
+    prefix += item.getName();
+    std::transform(prefix.begin() + std::ptrdiff_t(prefixLen), prefix.end(), prefix.begin() + std::ptrdiff_t(prefixLen),
+                   FoldCase);
+    m_caseInsensitiveMap.emplace(HashFolded(prefix), std::make_pair(prefix, &item));
+    if (item.getKind() == nod::Node::Kind::Directory) {
+      RecursiveBuildCaseInsensitiveMap(item, prefix);
+    }
+    prefix.resize(prefixLen);
   }
-  return node;
 }
 
 bool CDvdFile::Initialize(const std::string_view& path) {
@@ -267,9 +516,17 @@ bool CDvdFile::Initialize(const std::string_view& path) {
     return false;
   }
   m_dolBuf = m_DvdRoot->getDataPartition()->getDOLBuf();
+  m_caseInsensitiveMap.clear();
+  std::string prefix;
+  RecursiveBuildCaseInsensitiveMap(m_DvdRoot->getDataPartition()->getFSTRoot(), prefix);
+  if (m_MemoryMapEnabled) {
+    MapDiscImage(path);
+  }
 #ifdef HAS_DVD_THREAD
   m_WorkerRun.store(true);
-  m_WorkerThread = std::thread(WorkerProc);
+  for (u32 i = 0; i < m_ReaderThreadCount; ++i) {
+    m_WorkerThreads.emplace_back(WorkerProc, i);
+  }
 #endif
   return true;
 }
@@ -280,12 +537,23 @@ void CDvdFile::Shutdown() {
     return;
   }
   m_WorkerRun.store(false);
-  m_WorkerCV.notify_one();
-  if (m_WorkerThread.joinable()) {
-    m_WorkerThread.join();
+  m_WorkerCV.notify_all();
+  for (std::thread& thread : m_WorkerThreads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
   }
+  m_WorkerThreads.clear();
 #endif
-  m_RequestQueue.clear();
+  for (auto& queue : m_RequestQueues) {
+    queue.clear();
+  }
+  m_QueueStats = {};
+  m_BusyReaders.clear();
+  m_caseInsensitiveMap.clear();
+  CBasics::UnmapFile(m_MappedImage, m_MappedImageSize);
+  m_MappedImage = nullptr;
+  m_MappedImageSize = 0;
 }
 
 SDiscInfo CDvdFile::DiscInfo() {
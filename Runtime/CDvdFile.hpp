@@ -1,12 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "Runtime/GCNTypes.hpp"
 #include "Runtime/RetroTypes.hpp"
@@ -23,8 +28,27 @@ namespace metaforce {
 
 enum class ESeekOrigin { Begin = 0, Cur = 1, End = 2 };
 
+/* Scheduling class for asynchronous reads, highest priority first */
+enum class EDvdPriority : u8 {
+  AudioStream = 0,  // Streamed music and movie frames, must never starve
+  Foreground = 1,   // Resources something is actively waiting on
+  AreaPrefetch = 2, // MREA section streaming for upcoming areas
+  Background = 3,
+  MAX
+};
+constexpr size_t kNumDvdPriorities = size_t(EDvdPriority::MAX);
+
+struct SDvdQueueStats {
+  u32 queueDepth = 0;
+  u64 completedCount = 0;
+  u64 coalescedCount = 0;
+  float avgLatencyMs = 0.f;
+  float maxLatencyMs = 0.f;
+};
+
 struct DVDFileInfo;
 class IDvdRequest;
+class CFileDvdRequest;
 
 struct SDiscInfo {
   std::array<char, 6> gameId;
@@ -36,26 +60,39 @@ class CDvdFile {
   friend class CResLoader;
   friend class CFileDvdRequest;
   static std::unique_ptr<nod::DiscBase> m_DvdRoot;
-  //  static std::unordered_map<std::string, std::string> m_caseInsensitiveMap;
+  /* Case-folded full FST path -> node, keyed by hash; built once in Initialize */
+  static std::unordered_multimap<u64, std::pair<std::string, nod::Node*>> m_caseInsensitiveMap;
 #ifdef HAS_DVD_THREAD
-  static std::thread m_WorkerThread;
-  static std::mutex m_WorkerMutex;
+  static std::vector<std::thread> m_WorkerThreads;
   static std::condition_variable m_WorkerCV;
-  static std::mutex m_WaitMutex;
   static std::atomic_bool m_WorkerRun;
 #endif
-  static std::vector<std::shared_ptr<IDvdRequest>> m_RequestQueue;
+  static std::mutex m_WorkerMutex;
+  static u32 m_ReaderThreadCount;
+  static std::array<std::vector<std::shared_ptr<CFileDvdRequest>>, kNumDvdPriorities> m_RequestQueues;
+  static std::array<SDvdQueueStats, kNumDvdPriorities> m_QueueStats;
+  static std::vector<const nod::IPartReadStream*> m_BusyReaders;
   static std::string m_rootDirectory;
   static std::unique_ptr<u8[]> m_dolBuf;
-  static void WorkerProc();
+  static bool m_MemoryMapEnabled;
+  static const u8* m_MappedImage;
+  static u64 m_MappedImageSize;
+  static void MapDiscImage(std::string_view path);
+  static void WorkerProc(u32 idx);
+  static void EnqueueRequest(std::shared_ptr<CFileDvdRequest>&& req);
+  static bool PopRequestBatch(std::vector<std::shared_ptr<CFileDvdRequest>>& batchOut,
+                              const nod::IPartReadStream* lastReader, u64 lastEnd);
+  static void ServiceRequestBatch(std::vector<std::shared_ptr<CFileDvdRequest>>& batch);
 
   std::string x18_path;
   std::shared_ptr<nod::IPartReadStream> m_reader;
   uint64_t m_begin;
   uint64_t m_size;
+  uint64_t m_filePos = 0; // Logical position for ESeekOrigin::Cur, independent of in-flight requests
 
+  uint64_t ResolveReadOffset(ESeekOrigin whence, int off, u32 len);
   static nod::Node* ResolvePath(std::string_view path);
-  //  static void RecursiveBuildCaseInsensitiveMap(const hecl::ProjectPath& path, std::string::size_type prefixLen);
+  static void RecursiveBuildCaseInsensitiveMap(nod::Node& dir, std::string& prefix);
 
 public:
   static bool Initialize(const std::string_view& path);
@@ -65,22 +102,38 @@ public:
   static u8* GetDolBuf() { return m_dolBuf.get(); }
   static void DoWork();
 
+  /* Number of reader threads started by Initialize; changing it afterwards has no effect until restart */
+  static void SetReaderThreadCount(u32 count) { m_ReaderThreadCount = std::max(count, 1u); }
+  static SDvdQueueStats GetQueueStats(EDvdPriority prio);
+  /* Memory-map raw GameCube images at Initialize so file data can be accessed without copying */
+  static void SetMemoryMapEnabled(bool enabled) { m_MemoryMapEnabled = enabled; }
+  static bool IsDiscImageMapped() { return m_MappedImage != nullptr; }
+  /* Default time a request may wait before it is serviced ahead of higher priority classes */
+  static std::chrono::milliseconds GetDefaultDeadline(EDvdPriority prio);
+
   CDvdFile(std::string_view path);
   operator bool() const { return m_reader.operator bool(); }
-  void UpdateFilePos(int pos) { m_reader->seek(pos, SEEK_SET); }
+  void UpdateFilePos(int pos) { m_filePos = uint64_t(pos); }
   static bool FileExists(std::string_view path) {
     nod::Node* node = ResolvePath(path);
     return node != nullptr && node->getKind() == nod::Node::Kind::File;
   }
   void CloseFile() { m_reader.reset(); }
   std::shared_ptr<IDvdRequest> AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
+                                             std::function<void(u32)>&& cb = {},
+                                             EDvdPriority prio = EDvdPriority::Foreground);
+  std::shared_ptr<IDvdRequest> AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off, EDvdPriority prio,
+                                             std::chrono::milliseconds deadline,
                                              std::function<void(u32)>&& cb = {});
   u32 SyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int offset);
-  std::shared_ptr<IDvdRequest> AsyncRead(void* buf, u32 len, std::function<void(u32)>&& cb = {}) {
-    return AsyncSeekRead(buf, len, ESeekOrigin::Cur, 0, std::move(cb));
+  std::shared_ptr<IDvdRequest> AsyncRead(void* buf, u32 len, std::function<void(u32)>&& cb = {},
+                                         EDvdPriority prio = EDvdPriority::Foreground) {
+    return AsyncSeekRead(buf, len, ESeekOrigin::Cur, 0, std::move(cb), prio);
   }
-  u32 SyncRead(void* buf, u32 len) { return m_reader->read(buf, len); }
+  u32 SyncRead(void* buf, u32 len) { return SyncSeekRead(buf, len, ESeekOrigin::Cur, 0); }
   u64 Length() const { return m_size; }
+  /* View of [off, off + len) within this file, or an empty span if the image is not mapped */
+  std::span<const u8> GetMappedRange(u32 off, u32 len) const;
   std::string_view GetPath() const { return x18_path; }
 };
 } // namespace metaforce
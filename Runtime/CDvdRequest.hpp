@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 namespace metaforce {
 
 class IDvdRequest {
@@ -10,6 +12,10 @@ public:
   virtual bool IsComplete() = 0;
   virtual void PostCancelRequest() = 0;
 
+  /* Runs cb once the request completes, or immediately if it already has; dropped if the request is cancelled.
+   * Continuations may run on a DVD reader thread and should only hand work off (e.g. to CJobPool). */
+  virtual void ContinueWith(std::function<void()>&& cb) = 0;
+
   enum class EMediaType { ARAM = 0, Real = 1, File = 2, NOD = 3 };
   virtual EMediaType GetMediaType() const = 0;
 };
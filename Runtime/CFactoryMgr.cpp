@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstring>
 #include <iterator>
 #include "optick.h"
 
@@ -42,12 +43,8 @@ CFactoryFnReturn CFactoryMgr::MakeObjectFromMemory(const SObjectTag& tag, std::u
   const auto memFactoryIter = x24_memFactories.find(tag.type);
   if (memFactoryIter != x24_memFactories.cend()) {
     if (compressed) {
-      std::unique_ptr<CInputStream> compRead =
-          std::make_unique<CMemoryInStream>(localBuf.get(), size, CMemoryInStream::EOwnerShip::NotOwned);
-      const u32 decompLen = compRead->ReadLong();
-      CZipInputStream r(std::move(compRead));
-      std::unique_ptr<u8[]> decompBuf(new u8[decompLen]);
-      r.Get(decompBuf.get(), decompLen);
+      u32 decompLen = 0;
+      std::unique_ptr<u8[]> decompBuf = DecompressResource(localBuf.get(), size, decompLen);
       return memFactoryIter->second(tag, std::move(decompBuf), decompLen, paramXfer, selfRef);
     } else {
       return memFactoryIter->second(tag, std::move(localBuf), size, paramXfer, selfRef);
@@ -72,6 +69,35 @@ CFactoryFnReturn CFactoryMgr::MakeObjectFromMemory(const SObjectTag& tag, std::u
   }
 }
 
+CFactoryFnReturn CFactoryMgr::MakeObjectFromMappedMemory(const SObjectTag& tag, std::span<const u8> data,
+                                                         const CVParamTransfer& paramXfer, CObjectReference* selfRef) {
+  OPTICK_EVENT();
+  const auto memFactoryIter = x24_memFactories.find(tag.type);
+  if (memFactoryIter != x24_memFactories.cend()) {
+    std::unique_ptr<u8[]> buf(new u8[data.size()]);
+    std::memcpy(buf.get(), data.data(), data.size());
+    return memFactoryIter->second(tag, std::move(buf), u32(data.size()), paramXfer, selfRef);
+  }
+
+  const auto factoryIter = x10_factories.find(tag.type);
+  if (factoryIter == x10_factories.end()) {
+    return {};
+  }
+  CMemoryInStream r(data.data(), u32(data.size()), CMemoryInStream::EOwnerShip::NotOwned);
+  return factoryIter->second(tag, r, paramXfer, selfRef);
+}
+
+std::unique_ptr<u8[]> CFactoryMgr::DecompressResource(const u8* buf, int size, u32& decompLenOut) {
+  OPTICK_EVENT();
+  std::unique_ptr<CInputStream> compRead =
+      std::make_unique<CMemoryInStream>(buf, size, CMemoryInStream::EOwnerShip::NotOwned);
+  decompLenOut = compRead->ReadLong();
+  CZipInputStream r(std::move(compRead));
+  std::unique_ptr<u8[]> decompBuf(new u8[decompLenOut]);
+  r.Get(decompBuf.get(), decompLenOut);
+  return decompBuf;
+}
+
 CFactoryMgr::ETypeTable CFactoryMgr::FourCCToTypeIdx(FourCC fcc) {
   for (size_t i = 0; i < 4; ++i) {
     fcc.getChars()[i] = char(std::toupper(fcc.getChars()[i]));
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <span>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "Runtime/IFactory.hpp"
 #include "Runtime/Streams/IOStreams.hpp"
@@ -14,6 +16,7 @@ class IObj;
 class CFactoryMgr {
   std::unordered_map<FourCC, FFactoryFunc> x10_factories;
   std::unordered_map<FourCC, FMemFactoryFunc> x24_memFactories;
+  std::unordered_set<FourCC> m_threadSafeFactories;
 
 public:
   CFactoryFnReturn MakeObject(const SObjectTag& tag, metaforce::CInputStream& in, const CVParamTransfer& paramXfer,
@@ -21,9 +24,22 @@ public:
   bool CanMakeMemory(const metaforce::SObjectTag& tag) const;
   CFactoryFnReturn MakeObjectFromMemory(const SObjectTag& tag, std::unique_ptr<u8[]>&& buf, int size, bool compressed,
                                         const CVParamTransfer& paramXfer, CObjectReference* selfRef);
+  /* Builds from a non-owning view of uncompressed data (e.g. a memory-mapped disc image).
+   * Stream factories read in place; memory factories take ownership so they receive a copy. */
+  CFactoryFnReturn MakeObjectFromMappedMemory(const SObjectTag& tag, std::span<const u8> data,
+                                              const CVParamTransfer& paramXfer, CObjectReference* selfRef);
   void AddFactory(FourCC key, FFactoryFunc func) { x10_factories.insert_or_assign(key, std::move(func)); }
   void AddFactory(FourCC key, FMemFactoryFunc func) { x24_memFactories.insert_or_assign(key, std::move(func)); }
 
+  /* Marks a factory as safe to run off the main thread (no tokens, pools or graphics objects touched).
+   * Must be set up before any async builds are issued. */
+  void SetFactoryThreadSafe(FourCC key) { m_threadSafeFactories.insert(key); }
+  bool IsFactoryThreadSafe(const SObjectTag& tag) const { return m_threadSafeFactories.contains(tag.type); }
+
+  /* Inflates a compressed resource buffer (u32 decompressed length followed by zlib data).
+   * Has no dependencies on factory state and may be called from any thread. */
+  static std::unique_ptr<u8[]> DecompressResource(const u8* buf, int size, u32& decompLenOut);
+
   enum class ETypeTable : u8 {
     CLSN,
     CMDL,
@@ -0,0 +1,137 @@
+#include "Runtime/CJobPool.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include <logvisor/logvisor.hpp>
+#include <optick.h>
+
+namespace metaforce {
+
+CJobPool::CJobPool(std::string_view name, u32 threadCount) : m_name(name) {
+#ifdef HAS_JOB_THREADS
+  if (threadCount == 0) {
+    const u32 hwThreads = std::thread::hardware_concurrency();
+    threadCount = std::clamp(hwThreads > 1 ? hwThreads - 1 : 1u, 1u, 8u);
+  }
+  m_threads.reserve(threadCount);
+  for (u32 i = 0; i < threadCount; ++i) {
+    m_threads.emplace_back([this, i]() { WorkerProc(i); });
+  }
+#endif
+}
+
+CJobPool::~CJobPool() {
+#ifdef HAS_JOB_THREADS
+  {
+    std::unique_lock lk{m_mutex};
+    m_running = false;
+  }
+  m_cv.notify_all();
+  for (std::thread& thread : m_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+#endif
+}
+
+void CJobPool::WorkerProc(u32 idx) {
+#ifdef HAS_JOB_THREADS
+  const std::string threadName = fmt::format(FMT_STRING("{} {}"), m_name, idx);
+  logvisor::RegisterThreadName(threadName.c_str());
+  OPTICK_THREAD(threadName.c_str());
+
+  std::unique_lock lk{m_mutex};
+  while (true) {
+    m_cv.wait(lk, [this]() { return !m_running || !m_jobs.empty(); });
+    if (m_jobs.empty()) {
+      break;
+    }
+    FJob job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    lk.unlock();
+    job();
+    m_pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+    lk.lock();
+  }
+#endif
+}
+
+void CJobPool::Submit(FJob&& job) {
+  m_pendingJobs.fetch_add(1, std::memory_order_relaxed);
+#ifdef HAS_JOB_THREADS
+  {
+    std::unique_lock lk{m_mutex};
+    m_jobs.push_back(std::move(job));
+  }
+  m_cv.notify_one();
+#else
+  job();
+  m_pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+#endif
+}
+
+void CJobPool::ParallelFor(size_t count, size_t minChunk, const FRangeJob& job) {
+  if (count == 0) {
+    return;
+  }
+  minChunk = std::max<size_t>(minChunk, 1);
+  const size_t chunkCount = std::min<size_t>((count + minChunk - 1) / minChunk, GetThreadCount() + 1);
+  if (chunkCount <= 1) {
+    job(0, count);
+    return;
+  }
+
+#ifdef HAS_JOB_THREADS
+  struct SState {
+    std::atomic<size_t> next = 0;
+    std::atomic<size_t> done = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+  auto state = std::make_shared<SState>();
+  const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+  /* Helpers that start after every chunk was claimed exit without touching job,
+   * so capturing it by reference is safe even if they outlive this call. */
+  auto runChunks = [state, chunkSize, chunkCount, count, &job]() {
+    for (size_t c = state->next.fetch_add(1); c < chunkCount; c = state->next.fetch_add(1)) {
+      const size_t begin = c * chunkSize;
+      const size_t end = std::min(begin + chunkSize, count);
+      if (begin < end) {
+        job(begin, end);
+      }
+      if (state->done.fetch_add(1) + 1 == chunkCount) {
+        std::unique_lock lk{state->mutex};
+        state->cv.notify_all();
+      }
+    }
+  };
+
+  for (size_t i = 1; i < chunkCount; ++i) {
+    Submit(runChunks);
+  }
+  runChunks();
+
+  std::unique_lock lk{state->mutex};
+  state->cv.wait(lk, [&]() { return state->done.load() == chunkCount; });
+#else
+  job(0, count);
+#endif
+}
+
+u32 CJobPool::GetThreadCount() const {
+#ifdef HAS_JOB_THREADS
+  return u32(m_threads.size());
+#else
+  return 0;
+#endif
+}
+
+CJobPool& CJobPool::Shared() {
+  static CJobPool pool("CJobPool");
+  return pool;
+}
+
+} // namespace metaforce
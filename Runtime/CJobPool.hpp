@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Runtime/GCNTypes.hpp"
+
+#ifndef EMSCRIPTEN
+#define HAS_JOB_THREADS
+#endif
+
+namespace metaforce {
+
+/* Small fixed-size worker pool for CPU-only work that can leave the main thread
+ * (resource decompression, independent simulation batches, etc.).
+ * Without thread support, jobs run inline on the submitting thread. */
+class CJobPool {
+public:
+  using FJob = std::function<void()>;
+  using FRangeJob = std::function<void(size_t begin, size_t end)>;
+
+private:
+  std::string m_name;
+#ifdef HAS_JOB_THREADS
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<FJob> m_jobs;
+  bool m_running = true;
+#endif
+  std::atomic<u32> m_pendingJobs = 0;
+
+  void WorkerProc(u32 idx);
+
+public:
+  explicit CJobPool(std::string_view name, u32 threadCount = 0);
+  ~CJobPool();
+  CJobPool(const CJobPool&) = delete;
+  CJobPool& operator=(const CJobPool&) = delete;
+
+  /* Queues a job; it may run on any worker in any order relative to other jobs. */
+  void Submit(FJob&& job);
+
+  /* Splits [0, count) into chunks of at least minChunk items and runs them across the pool.
+   * The calling thread participates and this returns once every chunk has finished. */
+  void ParallelFor(size_t count, size_t minChunk, const FRangeJob& job);
+
+  u32 GetThreadCount() const;
+  u32 GetPendingJobCount() const { return m_pendingJobs.load(std::memory_order_relaxed); }
+
+  /* Process-wide pool shared by engine subsystems, created on first use. */
+  static CJobPool& Shared();
+};
+
+} // namespace metaforce
@@ -245,6 +245,8 @@ public:
 
     if (!m_projectInitialized && !m_deferredProject.empty()) {
       Log.report(logvisor::Info, FMT_STRING("Loading game from '{}'"), m_deferredProject);
+      CDvdFile::SetReaderThreadCount(m_cvarCommons.getDvdReaderThreads());
+      CDvdFile::SetMemoryMapEnabled(m_cvarCommons.getDvdMemoryMap());
       if (CDvdFile::Initialize(m_deferredProject)) {
         m_projectInitialized = true;
         m_cvarCommons.m_lastDiscPath->fromLiteral(m_deferredProject);
@@ -2,11 +2,13 @@
 
 namespace metaforce {
 
-CRandom16* CRandom16::g_randomNumber = nullptr;                // &DefaultRandom;
-CGlobalRandom* CGlobalRandom::g_currentGlobalRandom = nullptr; //&DefaultGlobalRandom;
+/* Per-thread so particle generators can be updated from CJobPool workers;
+ * the debug counters therefore only reflect the calling thread. */
+thread_local CRandom16* CRandom16::g_randomNumber = nullptr;                // &DefaultRandom;
+thread_local CGlobalRandom* CGlobalRandom::g_currentGlobalRandom = nullptr; //&DefaultGlobalRandom;
 namespace {
-u32 g_numNextCalls = 0;
-u32 g_lastSeed = 0;
+thread_local u32 g_numNextCalls = 0;
+thread_local u32 g_lastSeed = 0;
 };
 
 void CRandom16::IncrementNumNextCalls() { ++g_numNextCalls; }
@@ -6,7 +6,7 @@ namespace metaforce {
 
 class CRandom16 {
   s32 m_seed;
-  static CRandom16* g_randomNumber;
+  static thread_local CRandom16* g_randomNumber;
 
 public:
   explicit CRandom16(s32 seed = 99) : m_seed(seed) {}
@@ -40,7 +40,7 @@ public:
 class CGlobalRandom {
   CRandom16& m_random;
   CGlobalRandom* m_prev;
-  static CGlobalRandom* g_currentGlobalRandom;
+  static thread_local CGlobalRandom* g_currentGlobalRandom;
 
 public:
   CGlobalRandom(CRandom16& rand) : m_random(rand), m_prev(g_currentGlobalRandom) {
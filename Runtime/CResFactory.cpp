@@ -1,5 +1,8 @@
 #include "Runtime/CResFactory.hpp"
 
+#include <algorithm>
+
+#include "Runtime/CJobPool.hpp"
 #include "Runtime/CSimplePool.hpp"
 #include "Runtime/CStopwatch.hpp"
 #include "optick.h"
@@ -7,6 +10,24 @@
 namespace metaforce {
 static logvisor::Module Log("CResFactory");
 
+CResFactory::~CResFactory() {
+  /* Workers reference our factory manager; let in-flight jobs drain before tearing down.
+   * Once a read has completed its continuation is guaranteed to run and mark the build ready. */
+  for (auto& task : m_loadList) {
+    if (task.x8_dvdReq) {
+      task.x8_dvdReq->PostCancelRequest();
+    }
+    task.m_asyncBuild->m_cancelled.store(true, std::memory_order_relaxed);
+  }
+  for (auto* list : {&m_loadList, &m_cancelledList}) {
+    for (auto& task : *list) {
+      if (!task.x8_dvdReq || task.x8_dvdReq->IsComplete()) {
+        task.m_asyncBuild->WaitUntilReady();
+      }
+    }
+  }
+}
+
 void CResFactory::AddToLoadList(SLoadingData&& data) {
   const SObjectTag tag = data.x0_tag;
   m_loadMap.insert_or_assign(tag, m_loadList.insert(m_loadList.end(), std::move(data)));
@@ -14,7 +35,9 @@ void CResFactory::AddToLoadList(SLoadingData&& data) {
 
 CFactoryFnReturn CResFactory::BuildSync(const SObjectTag& tag, const CVParamTransfer& xfer, CObjectReference* selfRef) {
   CFactoryFnReturn ret;
-  if (x5c_factoryMgr.CanMakeMemory(tag)) {
+  if (const std::span<const u8> mapped = x4_loader.GetMappedResource(tag); !mapped.empty()) {
+    ret = x5c_factoryMgr.MakeObjectFromMappedMemory(tag, mapped, xfer, selfRef);
+  } else if (x5c_factoryMgr.CanMakeMemory(tag)) {
     std::unique_ptr<uint8_t[]> data;
     int size = 0;
     x4_loader.LoadMemResourceSync(tag, data, &size);
@@ -33,25 +56,101 @@ CFactoryFnReturn CResFactory::BuildSync(const SObjectTag& tag, const CVParamTran
   return ret;
 }
 
+void CResFactory::SubmitAsyncBuild(std::shared_ptr<SAsyncBuild> build, bool threadSafe, const SObjectTag& tag,
+                                   const CVParamTransfer& xfer, CObjectReference* selfRef) {
+  if (!build->m_compressed && !threadSafe) {
+    /* Nothing to do off-thread; the factory runs during finalization */
+    build->SetReady();
+    return;
+  }
+  CJobPool::Shared().Submit([this, build = std::move(build), threadSafe, tag, xfer, selfRef]() {
+    OPTICK_EVENT("CResFactory Async Build");
+    const auto startTime = std::chrono::steady_clock::now();
+    if (!build->m_cancelled.load(std::memory_order_relaxed)) {
+      if (build->m_compressed) {
+        u32 decompLen = 0;
+        build->m_buffer = CFactoryMgr::DecompressResource(build->m_buffer.get(), build->m_size, decompLen);
+        build->m_size = decompLen;
+        build->m_compressed = false;
+      }
+      if (threadSafe && !build->m_cancelled.load(std::memory_order_relaxed)) {
+        if (!build->m_mapped.empty()) {
+          build->m_object = x5c_factoryMgr.MakeObjectFromMappedMemory(tag, build->m_mapped, xfer, selfRef);
+        } else {
+          build->m_object =
+              x5c_factoryMgr.MakeObjectFromMemory(tag, std::move(build->m_buffer), build->m_size, false, xfer, selfRef);
+        }
+      }
+    }
+    build->m_asyncTime = std::chrono::steady_clock::now() - startTime;
+    build->SetReady();
+  });
+}
+
+void CResFactory::StartAsyncBuild(const SLoadingData& data) {
+  const bool threadSafe = x5c_factoryMgr.IsFactoryThreadSafe(data.x0_tag);
+  if (!data.x8_dvdReq) {
+    /* Mapped resource, no read to wait for */
+    SubmitAsyncBuild(data.m_asyncBuild, threadSafe, data.x0_tag, data.x18_cvXfer, data.m_selfRef);
+    return;
+  }
+  data.x8_dvdReq->ContinueWith([this, build = data.m_asyncBuild, threadSafe, tag = data.x0_tag,
+                                xfer = data.x18_cvXfer, selfRef = data.m_selfRef]() mutable {
+    SubmitAsyncBuild(std::move(build), threadSafe, tag, xfer, selfRef);
+  });
+}
+
+void CResFactory::FinishAsyncBuild(SLoadingData& data) {
+  SAsyncBuild& build = *data.m_asyncBuild;
+  if (build.m_object) {
+    *data.xc_targetPtr = std::move(build.m_object);
+  } else if (!build.m_mapped.empty()) {
+    *data.xc_targetPtr =
+        x5c_factoryMgr.MakeObjectFromMappedMemory(data.x0_tag, build.m_mapped, data.x18_cvXfer, data.m_selfRef);
+  } else {
+    *data.xc_targetPtr = x5c_factoryMgr.MakeObjectFromMemory(data.x0_tag, std::move(build.m_buffer), build.m_size,
+                                                             build.m_compressed, data.x18_cvXfer, data.m_selfRef);
+  }
+  data.m_asyncBuild.reset();
+  Log.report(logvisor::Info, FMT_STRING("async-built {}"), data.x0_tag);
+}
+
 bool CResFactory::PumpResource(SLoadingData& data) {
   OPTICK_EVENT();
-  if (data.x8_dvdReq && data.x8_dvdReq->IsComplete()) {
-    data.x8_dvdReq.reset();
-    *data.xc_targetPtr =
-        x5c_factoryMgr.MakeObjectFromMemory(data.x0_tag, std::move(data.x10_loadBuffer), data.x14_resSize,
-                                            data.m_compressed, data.x18_cvXfer, data.m_selfRef);
-    Log.report(logvisor::Info, FMT_STRING("async-built {}"), data.x0_tag);
-    return true;
+  if (!data.m_asyncBuild->IsReady()) {
+    return false;
   }
-  return false;
+  data.x8_dvdReq.reset();
+  const std::chrono::nanoseconds asyncTime = data.m_asyncBuild->m_asyncTime;
+  const auto startTime = std::chrono::steady_clock::now();
+  FinishAsyncBuild(data);
+  const std::chrono::nanoseconds finalizeTime = std::chrono::steady_clock::now() - startTime;
+
+  SResourceCost& cost = m_costTable[data.x0_tag.type];
+  ++cost.count;
+  cost.bytes += data.x14_resSize;
+  cost.asyncTime += asyncTime;
+  cost.finalizeTime += finalizeTime;
+  cost.maxFinalizeTime = std::max(cost.maxFinalizeTime, finalizeTime);
+  return true;
+}
+
+std::chrono::nanoseconds CResFactory::EstimateFinalize(const SLoadingData& data) const {
+  const auto search = m_costTable.find(data.x0_tag.type);
+  return search != m_costTable.end() ? search->second.EstimateFinalize(data.x14_resSize) : std::chrono::nanoseconds{};
 }
 
 std::unique_ptr<IObj> CResFactory::Build(const SObjectTag& tag, const CVParamTransfer& xfer,
                                          CObjectReference* selfRef) {
   auto search = m_loadMap.find(tag);
   if (search != m_loadMap.end()) {
-    while (!PumpResource(*search->second) || !search->second->xc_targetPtr) {}
-    std::unique_ptr<IObj> ret = std::move(*search->second->xc_targetPtr);
+    SLoadingData& data = *search->second;
+    if (data.x8_dvdReq) {
+      data.x8_dvdReq->WaitUntilComplete();
+    }
+    data.m_asyncBuild->WaitUntilReady();
+    PumpResource(data);
+    std::unique_ptr<IObj> ret = std::move(*data.xc_targetPtr);
     m_loadList.erase(search->second);
     m_loadMap.erase(search);
     return ret;
@@ -66,8 +165,15 @@ void CResFactory::BuildAsync(const SObjectTag& tag, const CVParamTransfer& xfer,
     SLoadingData data(tag, target, xfer, x4_loader.GetResourceCompression(tag), selfRef);
     data.x14_resSize = x4_loader.ResourceSize(tag);
     if (data.x14_resSize != 0) {
-      data.x10_loadBuffer = std::unique_ptr<u8[]>(new u8[data.x14_resSize]);
-      data.x8_dvdReq = x4_loader.LoadResourceAsync(tag, data.x10_loadBuffer.get());
+      data.m_asyncBuild = std::make_shared<SAsyncBuild>();
+      data.m_asyncBuild->m_size = data.x14_resSize;
+      data.m_asyncBuild->m_compressed = data.m_compressed;
+      data.m_asyncBuild->m_mapped = x4_loader.GetMappedResource(tag);
+      if (data.m_asyncBuild->m_mapped.empty()) {
+        data.m_asyncBuild->m_buffer = std::unique_ptr<u8[]>(new u8[data.x14_resSize]);
+        data.x8_dvdReq = x4_loader.LoadResourceAsync(tag, data.m_asyncBuild->m_buffer.get());
+      }
+      StartAsyncBuild(data);
       AddToLoadList(std::move(data));
     } else {
       *target = std::make_unique<TObjOwnerDerivedFromIObjUntyped>(nullptr);
@@ -77,30 +183,58 @@ void CResFactory::BuildAsync(const SObjectTag& tag, const CVParamTransfer& xfer,
 
 bool CResFactory::AsyncIdle(std::chrono::nanoseconds target) {
   OPTICK_EVENT();
+  m_cancelledList.remove_if([](const SLoadingData& task) { return task.m_asyncBuild->IsReady(); });
   if (m_loadList.empty()) {
     return false;
   }
-  auto startTime = std::chrono::high_resolution_clock::now();
-  do {
-    auto& task = m_loadList.front();
-    if (PumpResource(task)) {
-      m_loadMap.erase(task.x0_tag);
-      m_loadList.pop_front();
-      if (m_loadList.empty()) {
-        return false;
+#ifndef HAS_DVD_THREAD
+  /* No reader thread; service queued reads here so their continuations fire */
+  CDvdFile::DoWork();
+#endif
+  /* Finish whichever builds are ready, in request order, skipping any whose expected cost no longer
+   * fits the remaining idle time. The first ready build always finishes so loading can't stall. */
+  const auto deadline = std::chrono::steady_clock::now() + target;
+  bool finishedAny = false;
+  bool deferred = false;
+  for (auto it = m_loadList.begin(); it != m_loadList.end();) {
+    SLoadingData& task = *it;
+    if (!task.m_asyncBuild->IsReady()) {
+      ++it;
+      continue;
+    }
+    if (finishedAny) {
+      const auto remaining = deadline - std::chrono::steady_clock::now();
+      if (remaining <= std::chrono::nanoseconds::zero()) {
+        return true;
+      }
+      if (EstimateFinalize(task) > remaining) {
+        deferred = true;
+        ++it;
+        continue;
       }
     }
-  } while (std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - startTime) <
-           target);
-  return true;
+    PumpResource(task);
+    m_loadMap.erase(task.x0_tag);
+    it = m_loadList.erase(it);
+    finishedAny = true;
+  }
+  return deferred;
 }
 
 void CResFactory::CancelBuild(const SObjectTag& tag) {
   auto search = m_loadMap.find(tag);
   if (search != m_loadMap.end()) {
-    if (search->second->x8_dvdReq)
-      search->second->x8_dvdReq->PostCancelRequest();
-    m_loadList.erase(search->second);
+    SLoadingData& task = *search->second;
+    if (task.x8_dvdReq)
+      task.x8_dvdReq->PostCancelRequest();
+    task.m_asyncBuild->m_cancelled.store(true, std::memory_order_relaxed);
+    /* A read that completed before the cancel has already handed its build to a job */
+    if ((!task.x8_dvdReq || task.x8_dvdReq->IsComplete()) && !task.m_asyncBuild->IsReady()) {
+      task.xc_targetPtr = nullptr;
+      m_cancelledList.splice(m_cancelledList.end(), m_loadList, search->second);
+    } else {
+      m_loadList.erase(search->second);
+    }
     m_loadMap.erase(search);
   }
 }
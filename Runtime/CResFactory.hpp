@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -19,15 +23,43 @@ class CResFactory : public IFactory {
   CFactoryMgr x5c_factoryMgr;
 
 public:
+  /* Decompression/construction stage shared with a CJobPool worker once the DVD read completes.
+   * The worker only touches this block; the main thread publishes the result to CObjectReference. */
+  struct SAsyncBuild {
+    std::atomic_bool m_ready = false;
+    std::atomic_bool m_cancelled = false;
+    std::mutex m_readyMutex;
+    std::condition_variable m_readyCV;
+    std::unique_ptr<u8[]> m_buffer;
+    std::span<const u8> m_mapped; // Uncompressed data in the memory-mapped disc image, used instead of m_buffer
+    u32 m_size = 0;
+    bool m_compressed = false;
+    CFactoryFnReturn m_object;
+    std::chrono::nanoseconds m_asyncTime{}; // Published by SetReady
+
+    bool IsReady() const { return m_ready.load(std::memory_order_acquire); }
+    void SetReady() {
+      {
+        std::unique_lock lk{m_readyMutex};
+        m_ready.store(true, std::memory_order_release);
+      }
+      m_readyCV.notify_all();
+    }
+    void WaitUntilReady() {
+      std::unique_lock lk{m_readyMutex};
+      m_readyCV.wait(lk, [this]() { return IsReady(); });
+    }
+  };
+
   struct SLoadingData {
     SObjectTag x0_tag;
     std::shared_ptr<IDvdRequest> x8_dvdReq;
     std::unique_ptr<IObj>* xc_targetPtr = nullptr;
-    std::unique_ptr<u8[]> x10_loadBuffer;
     u32 x14_resSize = 0;
     CVParamTransfer x18_cvXfer;
     bool m_compressed = false;
     CObjectReference* m_selfRef = nullptr;
+    std::shared_ptr<SAsyncBuild> m_asyncBuild;
 
     SLoadingData() = default;
     SLoadingData(const SObjectTag& tag, std::unique_ptr<IObj>* ptr, const CVParamTransfer& xfer, bool compressed,
@@ -38,17 +70,27 @@ public:
 private:
   std::list<SLoadingData> m_loadList;
   std::unordered_map<SObjectTag, std::list<SLoadingData>::iterator> m_loadMap;
+  /* Cancelled builds whose job may still run; the job uses the factory, so teardown waits on these too */
+  std::list<SLoadingData> m_cancelledList;
   std::vector<CToken> m_nonWorldTokens; /* URDE: always keep non-world resources resident */
+  ResourceCostTable m_costTable;
   void AddToLoadList(SLoadingData&& data);
   CFactoryFnReturn BuildSync(const SObjectTag&, const CVParamTransfer&, CObjectReference* selfRef);
+  void StartAsyncBuild(const SLoadingData& data);
+  void SubmitAsyncBuild(std::shared_ptr<SAsyncBuild> build, bool threadSafe, const SObjectTag& tag,
+                        const CVParamTransfer& xfer, CObjectReference* selfRef);
+  void FinishAsyncBuild(SLoadingData& data);
   bool PumpResource(SLoadingData& data);
+  std::chrono::nanoseconds EstimateFinalize(const SLoadingData& data) const;
 
 public:
+  ~CResFactory() override;
   CResLoader& GetLoader() { return x4_loader; }
   std::unique_ptr<IObj> Build(const SObjectTag&, const CVParamTransfer&, CObjectReference* selfRef) override;
   void BuildAsync(const SObjectTag&, const CVParamTransfer&, std::unique_ptr<IObj>*,
                   CObjectReference* selfRef) override;
   bool AsyncIdle(std::chrono::nanoseconds target) override;
+  const ResourceCostTable* GetResourceCostTable() const override { return &m_costTable; }
   void CancelBuild(const SObjectTag&) override;
 
   bool CanBuild(const SObjectTag& tag) override { return x4_loader.ResourceExists(tag); }
@@ -73,7 +115,8 @@ public:
 
   std::shared_ptr<IDvdRequest> LoadResourcePartAsync(const metaforce::SObjectTag& tag, u32 off, u32 size,
                                                      void* target) override {
-    return x4_loader.LoadResourcePartAsync(tag, off, size, target);
+    /* Only used for MREA section streaming */
+    return x4_loader.LoadResourcePartAsync(tag, off, size, target, EDvdPriority::AreaPrefetch);
   }
 
   const SObjectTag* GetResourceIdByName(std::string_view name) const override {
@@ -1,5 +1,7 @@
 #include "Runtime/CResLoader.hpp"
 
+#include <iterator>
+
 #include "Runtime/CPakFile.hpp"
 
 namespace metaforce {
@@ -71,6 +73,14 @@ std::unique_ptr<CInputStream> CResLoader::LoadNewResourceSync(const SObjectTag&
   if (CPakFile* const file = FindResourceForLoad(tag)) {
     const size_t resSz = ROUND_UP_32(x50_cachedResInfo->GetSize());
 
+    if (extBuf == nullptr && !x50_cachedResInfo->IsCompressed()) {
+      const std::span<const u8> mapped = file->GetMappedRange(x50_cachedResInfo->GetOffset(), resSz);
+      if (!mapped.empty()) {
+        return std::make_unique<CMemoryInStream>(mapped.data(), u32(mapped.size()),
+                                                 CMemoryInStream::EOwnerShip::NotOwned);
+      }
+    }
+
     void* buf = extBuf;
     if (buf == nullptr) {
       buf = new u8[resSz];
@@ -92,15 +102,16 @@ std::unique_ptr<CInputStream> CResLoader::LoadNewResourceSync(const SObjectTag&
   return nullptr;
 }
 
-std::shared_ptr<IDvdRequest> CResLoader::LoadResourcePartAsync(const SObjectTag& tag, u32 off, u32 size, void* buf) {
+std::shared_ptr<IDvdRequest> CResLoader::LoadResourcePartAsync(const SObjectTag& tag, u32 off, u32 size, void* buf,
+                                                               EDvdPriority prio) {
   CPakFile* file = FindResourceForLoad(tag.id);
-  return file->AsyncSeekRead(buf, size, ESeekOrigin::Begin, x50_cachedResInfo->GetOffset() + off);
+  return file->AsyncSeekRead(buf, size, ESeekOrigin::Begin, x50_cachedResInfo->GetOffset() + off, {}, prio);
 }
 
-std::shared_ptr<IDvdRequest> CResLoader::LoadResourceAsync(const SObjectTag& tag, void* buf) {
+std::shared_ptr<IDvdRequest> CResLoader::LoadResourceAsync(const SObjectTag& tag, void* buf, EDvdPriority prio) {
   CPakFile* file = FindResourceForLoad(tag.id);
   return file->AsyncSeekRead(buf, ROUND_UP_32(x50_cachedResInfo->GetSize()), ESeekOrigin::Begin,
-                             x50_cachedResInfo->GetOffset());
+                             x50_cachedResInfo->GetOffset(), {}, prio);
 }
 
 std::unique_ptr<u8[]> CResLoader::LoadResourceSync(const metaforce::SObjectTag& tag) {
@@ -111,6 +122,17 @@ std::unique_ptr<u8[]> CResLoader::LoadResourceSync(const metaforce::SObjectTag&
   return ret;
 }
 
+std::span<const u8> CResLoader::GetMappedResource(const SObjectTag& tag) {
+  if (!CDvdFile::IsDiscImageMapped()) {
+    return {};
+  }
+  CPakFile* const file = FindResourceForLoad(tag.id);
+  if (file == nullptr || x50_cachedResInfo->IsCompressed()) {
+    return {};
+  }
+  return file->GetMappedRange(x50_cachedResInfo->GetOffset(), x50_cachedResInfo->GetSize());
+}
+
 std::unique_ptr<u8[]> CResLoader::LoadNewResourcePartSync(const metaforce::SObjectTag& tag, u32 off, u32 size) {
   CPakFile* file = FindResourceForLoad(tag.id);
   std::unique_ptr<u8[]> ret(new u8[size]);
@@ -192,25 +214,53 @@ void CResLoader::AsyncIdlePakLoading() {
   }
 }
 
-bool CResLoader::FindResource(CAssetId id) const {
-  if (x4c_cachedResId == id)
+const CResLoader::SResIndexEntry* CResLoader::FindIndexEntry(CAssetId id) const {
+  const auto search = m_resIndex.find(id);
+  if (search == m_resIndex.end()) {
+    ++m_lookupStats.misses;
+    return nullptr;
+  }
+  return &search->second;
+}
+
+bool CResLoader::SelectPak(CAssetId id, PakList::iterator& pak) const {
+  const SResIndexEntry* entry = FindIndexEntry(id);
+  if (entry == nullptr) {
+    return false;
+  }
+
+  /* The current pak may hold a closer duplicate of a non-override asset; keep preferring it */
+  if (!entry->isOverride && x48_curPak != x18_pakLoadedList.end() && (*x48_curPak)->GetResInfo(id) != nullptr) {
+    pak = x48_curPak;
+    return true;
+  }
+  if (!(*entry->pak)->x28_27_stashedInARAM) {
+    pak = entry->pak;
     return true;
+  }
 
-  for (auto it = m_overridePakList.begin(); it != m_overridePakList.end(); ++it) {
-    if (CacheFromPak(**it, id)) {
-      return true;
+  /* The index only records the first pak holding id; if that one is stashed, scan the rest like before */
+  for (const PakList* list : {&m_overridePakList, &x18_pakLoadedList}) {
+    for (auto it = const_cast<PakList*>(list)->begin(); it != list->end(); ++it) {
+      if ((*it)->GetResInfo(id) != nullptr) {
+        pak = it;
+        return true;
+      }
     }
   }
+  return false;
+}
 
-  if (x48_curPak != x18_pakLoadedList.end())
-    if (CacheFromPak(**x48_curPak, id))
-      return true;
+bool CResLoader::FindResource(CAssetId id) const {
+  ++m_lookupStats.lookups;
+  if (x4c_cachedResId == id) {
+    ++m_lookupStats.cacheHits;
+    return true;
+  }
 
-  for (auto it = x18_pakLoadedList.begin(); it != x18_pakLoadedList.end(); ++it) {
-    if (it == x48_curPak)
-      continue;
-    if (CacheFromPak(**it, id))
-      return true;
+  PakList::iterator pak;
+  if (SelectPak(id, pak) && CacheFromPak(**pak, id)) {
+    return true;
   }
 
   Log.report(logvisor::Warning, FMT_STRING("Unable to find asset {}"), id);
@@ -218,23 +268,13 @@ bool CResLoader::FindResource(CAssetId id) const {
 }
 
 CPakFile* CResLoader::FindResourceForLoad(CAssetId id) {
-  for (auto it = m_overridePakList.begin(); it != m_overridePakList.end(); ++it) {
-    if (CacheFromPakForLoad(**it, id)) {
-      return &**it;
-    }
-  }
-
-  if (x48_curPak != x18_pakLoadedList.end())
-    if (CacheFromPakForLoad(**x48_curPak, id))
-      return &**x48_curPak;
-
-  for (auto it = x18_pakLoadedList.begin(); it != x18_pakLoadedList.end(); ++it) {
-    if (it == x48_curPak)
-      continue;
-    if (CacheFromPakForLoad(**it, id)) {
-      x48_curPak = it;
-      return &**it;
+  ++m_lookupStats.lookups;
+  PakList::iterator pak;
+  if (SelectPak(id, pak) && CacheFromPakForLoad(**pak, id)) {
+    if (!(*pak)->IsOverridePak()) {
+      x48_curPak = pak;
     }
+    return &**pak;
   }
 
   Log.report(logvisor::Error, FMT_STRING("Unable to find asset {}"), id);
@@ -270,10 +310,26 @@ bool CResLoader::CacheFromPak(const CPakFile& file, CAssetId id) const {
 }
 
 void CResLoader::MoveToCorrectLoadedList(std::unique_ptr<CPakFile>&& file) {
-  if (file->IsOverridePak())
-    m_overridePakList.push_back(std::move(file));
-  else
-    x18_pakLoadedList.push_back(std::move(file));
+  PakList& list = file->IsOverridePak() ? m_overridePakList : x18_pakLoadedList;
+  list.push_back(std::move(file));
+  AddToResourceIndex(std::prev(list.end()));
+}
+
+void CResLoader::AddToResourceIndex(PakList::iterator pak) {
+  const bool override = (*pak)->IsOverridePak();
+  const std::vector<CPakFile::SResInfo>& resList = (*pak)->x74_resList;
+  m_resIndex.reserve(m_resIndex.size() + resList.size());
+  for (auto it = resList.begin(); it != resList.end(); ++it) {
+    /* The table is sorted by id; only the first of any duplicates is indexed, matching GetResInfo */
+    if (it != resList.begin() && std::prev(it)->x0_id == it->x0_id) {
+      continue;
+    }
+    /* Paks earlier in their list win, and any override pak beats a regular one */
+    const auto [entry, inserted] = m_resIndex.try_emplace(it->x0_id, SResIndexEntry{pak, override});
+    if (!inserted && override && !entry->second.isOverride) {
+      entry->second = SResIndexEntry{pak, override};
+    }
+  }
 }
 
 std::vector<std::pair<std::string, SObjectTag>> CResLoader::GetResourceIdToNameList() const {
@@ -3,7 +3,9 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Runtime/CPakFile.hpp"
@@ -14,7 +16,21 @@ namespace metaforce {
 class IDvdRequest;
 struct SObjectTag;
 
+struct SResLookupStats {
+  u32 lookups = 0;
+  u32 cacheHits = 0;
+  u32 misses = 0;
+};
+
 class CResLoader {
+  using PakList = std::list<std::unique_ptr<CPakFile>>;
+
+  /* Owning pak of an asset id across every loaded pak; override paks take precedence */
+  struct SResIndexEntry {
+    PakList::iterator pak;
+    bool isOverride;
+  };
+
   std::string m_loaderPath;
   // std::list<std::unique_ptr<CPakFile>> x0_aramList;
   std::list<std::unique_ptr<CPakFile>> x18_pakLoadedList;
@@ -26,6 +42,14 @@ class CResLoader {
   mutable CAssetId x4c_cachedResId;
   mutable const CPakFile::SResInfo* x50_cachedResInfo = nullptr;
   bool x54_forwardSeek = false;
+  std::unordered_map<CAssetId, SResIndexEntry> m_resIndex;
+  mutable SResLookupStats m_lookupStats;
+  SResLookupStats m_lastFrameLookupStats;
+
+  void AddToResourceIndex(PakList::iterator pak);
+  const SResIndexEntry* FindIndexEntry(CAssetId id) const;
+  /* Shared by FindResource and FindResourceForLoad so both describe the entry that is actually read */
+  bool SelectPak(CAssetId id, PakList::iterator& pak) const;
 
   bool _GetTagListForFile(std::vector<SObjectTag>& out, const std::string& path,
                           const std::unique_ptr<CPakFile>& file) const;
@@ -40,9 +64,13 @@ public:
   void LoadMemResourceSync(const SObjectTag& tag, std::unique_ptr<u8[]>& bufOut, int* sizeOut);
   std::unique_ptr<CInputStream> LoadResourceFromMemorySync(const SObjectTag& tag, const void* buf);
   std::unique_ptr<CInputStream> LoadNewResourceSync(const SObjectTag& tag, void* extBuf = nullptr);
-  std::shared_ptr<IDvdRequest> LoadResourcePartAsync(const SObjectTag& tag, u32 off, u32 size, void* buf);
-  std::shared_ptr<IDvdRequest> LoadResourceAsync(const SObjectTag& tag, void* buf);
+  std::shared_ptr<IDvdRequest> LoadResourcePartAsync(const SObjectTag& tag, u32 off, u32 size, void* buf,
+                                                     EDvdPriority prio = EDvdPriority::Foreground);
+  std::shared_ptr<IDvdRequest> LoadResourceAsync(const SObjectTag& tag, void* buf,
+                                                 EDvdPriority prio = EDvdPriority::Foreground);
   std::unique_ptr<u8[]> LoadResourceSync(const metaforce::SObjectTag& tag);
+  /* Zero-copy view of an uncompressed resource when the disc image is memory-mapped, empty otherwise */
+  std::span<const u8> GetMappedResource(const SObjectTag& tag);
   std::unique_ptr<u8[]> LoadNewResourcePartSync(const metaforce::SObjectTag& tag, u32 off, u32 size);
   void GetTagListForFile(const char* pakName, std::vector<SObjectTag>& out) const;
   bool GetResourceCompression(const SObjectTag& tag) const;
@@ -62,6 +90,12 @@ public:
   void EnumerateResources(const std::function<bool(const SObjectTag&)>& lambda) const;
   void EnumerateNamedResources(const std::function<bool(std::string_view, const SObjectTag&)>& lambda) const;
   const std::list<std::unique_ptr<CPakFile>>& GetPaks() const { return x18_pakLoadedList; }
+  size_t GetResourceIndexSize() const { return m_resIndex.size(); }
+  const SResLookupStats& GetLastFrameLookupStats() const { return m_lastFrameLookupStats; }
+  void EndFrameLookupStats() {
+    m_lastFrameLookupStats = m_lookupStats;
+    m_lookupStats = {};
+  }
 };
 
 } // namespace metaforce
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <utility>
 
 namespace metaforce {
 namespace {
@@ -18,6 +19,14 @@ auto AccessElement(const T& arr, S idx) -> typename T::const_reference {
   assert(std::size(arr) > static_cast<size_t>(idx) && idx >= 0);
   return arr[idx];
 }
+
+/* Intersection chains are threaded through this rather than the nodes so that near-list
+ * queries can run on several threads at once. Every entry is -1 between queries. */
+thread_local std::array<s16, kMaxEntities> g_NextInChain = [] {
+  std::array<s16, kMaxEntities> ret;
+  ret.fill(-1);
+  return ret;
+}();
 } // Anonymous namespace
 
 CSortedListManager::CSortedListManager() { Reset(); }
@@ -30,19 +39,19 @@ void CSortedListManager::Reset() {
   }
 }
 
-void CSortedListManager::AddToLinkedList(s16 nodeId, s16& headId, s16& tailId) {
+void CSortedListManager::AddToLinkedList(s16 nodeId, s16& headId, s16& tailId) const {
   if (headId == -1) {
-    AccessElement(x0_nodes, nodeId).x28_next = headId;
+    AccessElement(g_NextInChain, nodeId) = headId;
     headId = nodeId;
     tailId = nodeId;
   } else {
-    if (AccessElement(x0_nodes, nodeId).x28_next != -1) {
+    if (AccessElement(g_NextInChain, nodeId) != -1) {
       return;
     }
     if (tailId == nodeId) {
       return;
     }
-    AccessElement(x0_nodes, nodeId).x28_next = headId;
+    AccessElement(g_NextInChain, nodeId) = headId;
     headId = nodeId;
   }
 }
@@ -156,7 +165,7 @@ s16 CSortedListManager::FindInListLower(ESortedList list, float value) const {
   return idx;
 }
 
-s16 CSortedListManager::ConstructIntersectionArray(const zeus::CAABox& aabb) {
+s16 CSortedListManager::ConstructIntersectionArray(const zeus::CAABox& aabb) const {
   const int minXa = FindInListLower(ESortedList::MinX, aabb.min.x());
   const int maxXa = FindInListUpper(ESortedList::MinX, aabb.max.x());
   const int minXb = FindInListLower(ESortedList::MaxX, aabb.min.x());
@@ -189,7 +198,7 @@ s16 CSortedListManager::ConstructIntersectionArray(const zeus::CAABox& aabb) {
 
 s16 CSortedListManager::CalculateIntersections(ESortedList la, ESortedList lb, s16 a, s16 b, s16 c, s16 d,
                                                ESortedList slA, ESortedList slB, ESortedList slC, ESortedList slD,
-                                               const zeus::CAABox& aabb) {
+                                               const zeus::CAABox& aabb) const {
   const auto listAIndex = static_cast<size_t>(la);
   const auto listBIndex = static_cast<size_t>(lb);
 
@@ -219,22 +228,23 @@ s16 CSortedListManager::CalculateIntersections(ESortedList la, ESortedList lb, s
   }
 
   for (s16* id = &headId; *id != -1;) {
-    SNode& node = AccessElement(x0_nodes, *id);
+    const SNode& node = AccessElement(x0_nodes, *id);
+    s16& next = AccessElement(g_NextInChain, *id);
     if (node.x4_box[size_t(slA)] > aabb[size_t(slB)] || node.x4_box[size_t(slB)] < aabb[size_t(slA)] ||
         node.x4_box[size_t(slC)] > aabb[size_t(slD)] || node.x4_box[size_t(slD)] < aabb[size_t(slC)]) {
       /* Not intersecting; remove from chain */
-      *id = node.x28_next;
-      node.x28_next = -1;
+      *id = next;
+      next = -1;
       continue;
     }
-    id = &node.x28_next;
+    id = &next;
   }
 
   return headId;
 }
 
 void CSortedListManager::BuildNearList(EntityList& out, const zeus::CVector3f& pos, const zeus::CVector3f& dir,
-                                       float mag, const CMaterialFilter& filter, const CActor* actor) {
+                                       float mag, const CMaterialFilter& filter, const CActor* actor) const {
   if (mag == 0.f) {
     mag = 8000.f;
   }
@@ -245,32 +255,30 @@ void CSortedListManager::BuildNearList(EntityList& out, const zeus::CVector3f& p
   BuildNearList(out, zeus::CAABox(mins, maxs), filter, actor);
 }
 
-void CSortedListManager::BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb) {
+void CSortedListManager::BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb) const {
   const CMaterialFilter& filter = actor.GetMaterialFilter();
   s16 id = ConstructIntersectionArray(aabb);
   while (id != -1) {
-    SNode& node = AccessElement(x0_nodes, id);
+    const SNode& node = AccessElement(x0_nodes, id);
     if (&actor != node.x0_actor && filter.Passes(node.x0_actor->GetMaterialList()) &&
         node.x0_actor->GetMaterialFilter().Passes(actor.GetMaterialList())) {
       out.push_back(node.x0_actor->GetUniqueId());
     }
 
-    id = node.x28_next;
-    node.x28_next = -1;
+    id = std::exchange(AccessElement(g_NextInChain, id), s16(-1));
   }
 }
 
 void CSortedListManager::BuildNearList(EntityList& out, const zeus::CAABox& aabb, const CMaterialFilter& filter,
-                                       const CActor* actor) {
+                                       const CActor* actor) const {
   s16 id = ConstructIntersectionArray(aabb);
   while (id != -1) {
-    SNode& node = AccessElement(x0_nodes, id);
+    const SNode& node = AccessElement(x0_nodes, id);
     if (actor != node.x0_actor && filter.Passes(node.x0_actor->GetMaterialList())) {
       out.push_back(node.x0_actor->GetUniqueId());
     }
 
-    id = node.x28_next;
-    node.x28_next = -1;
+    id = std::exchange(AccessElement(g_NextInChain, id), s16(-1));
   }
 }
 
@@ -23,7 +23,6 @@ class CSortedListManager {
     const CActor* x0_actor = nullptr;
     zeus::CAABox x4_box = zeus::skNullBox;
     std::array<s16, 6> x1c_selfIdxs{-1, -1, -1, -1, -1, -1};
-    s16 x28_next = -1;
     bool x2a_populated = false;
     SNode() = default;
     SNode(const CActor* act, const zeus::CAABox& aabb) : x0_actor(act), x4_box(aabb), x2a_populated(true) {}
@@ -31,22 +30,24 @@ class CSortedListManager {
   std::array<SNode, kMaxEntities> x0_nodes;
   std::array<SSortedList, 6> xb000_sortedLists;
   void Reset();
-  void AddToLinkedList(s16 nodeId, s16& headId, s16& tailId);
+  void AddToLinkedList(s16 nodeId, s16& headId, s16& tailId) const;
   void RemoveFromList(ESortedList list, s16 idx);
   void MoveInList(ESortedList list, s16 idx);
   void InsertInList(ESortedList list, SNode& node);
   s16 FindInListUpper(ESortedList list, float value) const;
   s16 FindInListLower(ESortedList list, float value) const;
-  s16 ConstructIntersectionArray(const zeus::CAABox& aabb);
+  s16 ConstructIntersectionArray(const zeus::CAABox& aabb) const;
   s16 CalculateIntersections(ESortedList la, ESortedList lb, s16 a, s16 b, s16 c, s16 d, ESortedList slA,
-                             ESortedList slB, ESortedList slC, ESortedList slD, const zeus::CAABox& aabb);
+                             ESortedList slB, ESortedList slC, ESortedList slD, const zeus::CAABox& aabb) const;
 
 public:
   CSortedListManager();
+  /* Queries only read the lists, so they may run concurrently as long as nothing is moved meanwhile */
   void BuildNearList(EntityList& out, const zeus::CVector3f& pos, const zeus::CVector3f& dir, float mag,
-                     const CMaterialFilter& filter, const CActor* actor);
-  void BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb);
-  void BuildNearList(EntityList& out, const zeus::CAABox& aabb, const CMaterialFilter& filter, const CActor* actor);
+                     const CMaterialFilter& filter, const CActor* actor) const;
+  void BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb) const;
+  void BuildNearList(EntityList& out, const zeus::CAABox& aabb, const CMaterialFilter& filter,
+                     const CActor* actor) const;
   void Remove(const CActor* actor);
   void Move(const CActor* actor, const zeus::CAABox& aabb);
   void Insert(const CActor* actor, const zeus::CAABox& aabb);
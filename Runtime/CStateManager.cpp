@@ -1,11 +1,14 @@
 #include "Runtime/CStateManager.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 
 #include "Runtime/AutoMapper/CMapWorldInfo.hpp"
 #include "Runtime/Camera/CBallCamera.hpp"
 #include "Runtime/Camera/CCameraShakeData.hpp"
 #include "Runtime/Camera/CGameCamera.hpp"
+#include "Runtime/Character/CAnimData.hpp"
 #include "Runtime/CGameState.hpp"
 #include "Runtime/CMemoryCardSys.hpp"
 #include "Runtime/Collision/CCollisionActor.hpp"
@@ -47,6 +50,7 @@
 #include "Runtime/World/CSnakeWeedSwarm.hpp"
 #include "Runtime/World/CWallCrawlerSwarm.hpp"
 #include "Runtime/World/CWorld.hpp"
+#include "Runtime/ConsoleVariables/CVarCommons.hpp"
 #include "Runtime/ConsoleVariables/CVarManager.hpp"
 
 #include "TCastTo.hpp" // Generated file, do not modify include path
@@ -60,6 +64,22 @@ CVar* debugToolDrawCollisionActors = nullptr;
 CVar* debugToolDrawMazePath = nullptr;
 CVar* debugToolDrawPlatformCollision = nullptr;
 CVar* sm_logScripting = nullptr;
+
+template <typename Func>
+void TimeUpdate(bool timed, u64& nanos, Func&& func) {
+  if (!timed) {
+    func();
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* The camera list hides cameras with scripting blocked, so those still update like any other object */
+bool IsUpdateCamera(const CEntityUpdateList::SEntry& entry) {
+  return entry.bucket == EUpdateBucket::Camera && !entry.ent->IsScriptingBlocked();
+}
 } // namespace
 logvisor::Module LogModule("metaforce::CStateManager");
 CStateManager::CStateManager(const std::weak_ptr<CScriptMailbox>& mailbox, const std::weak_ptr<CMapWorldInfo>& mwInfo,
@@ -79,6 +99,7 @@ CStateManager::CStateManager(const std::weak_ptr<CScriptMailbox>& mailbox, const
   x880_envFxManager = &x86c_stateManagerContainer->xe510_envFxManager;
   x884_actorModelParticles = &x86c_stateManagerContainer->xf168_actorModelParticles;
   x88c_rumbleManager = &x86c_stateManagerContainer->xf250_rumbleManager;
+  x890_scriptIdMap.reserve(kMaxEntities);
 
   g_Renderer->SetDrawableCallback(&CStateManager::RendererDrawCallback, this);
   x90c_loaderFuncs.resize(int(EScriptObjectType::ScriptObjectTypeMAX));
@@ -222,6 +243,10 @@ CStateManager::CStateManager(const std::weak_ptr<CScriptMailbox>& mailbox, const
         CVar::EFlags::ReadOnly | CVar::EFlags::Archive | CVar::EFlags::Game);
   }
   m_logScriptingReference.emplace(&m_logScripting, sm_logScripting);
+
+  if (CVarCommons* commons = CVarCommons::instance()) {
+    m_timeUpdateBucketsReference.emplace(&m_timeUpdateBuckets, commons->m_debugOverlayShowUpdateBucketStats);
+  }
 }
 
 CStateManager::~CStateManager() {
@@ -526,6 +551,7 @@ bool CStateManager::CanCreateProjectile(TUniqueId uid, EWeaponType type, int max
 void CStateManager::BuildDynamicLightListForWorld() {
   if (x8b8_playerState->GetActiveVisor(*this) == CPlayerState::EPlayerVisor::Thermal) {
     x8e0_dynamicLights.clear();
+    m_dynamicLightGrid.Clear();
     return;
   }
 
@@ -555,6 +581,10 @@ void CStateManager::BuildDynamicLightListForWorld() {
       return false;
     }
   });
+
+  /* Game lights follow their actors, so the index is rebuilt with the list; that is linear in the light count,
+   * against the actors x lights sphere tests it saves in CActorLights */
+  m_dynamicLightGrid.Build(x8e0_dynamicLights, 1.f);
 }
 
 void CStateManager::DrawDebugStuff() const {
@@ -1080,6 +1110,8 @@ void CStateManager::PreRender() {
   xf7c_projectedShadow = nullptr;
   x850_world->PreRender();
   BuildDynamicLightListForWorld();
+  /* Visible characters queue their poses here and get evaluated together once every actor has had its PreRender */
+  CAnimData::BeginPoseBatch();
   for (const CGameArea& area : *x850_world) {
     auto occState = CGameArea::EOcclusionState::Occluded;
     if (area.IsPostConstructed()) {
@@ -1096,6 +1128,7 @@ void CStateManager::PreRender() {
       }
     }
   }
+  CAnimData::FlushPoseBatch();
 
   CacheReflection();
   g_Renderer->PrepareDynamicLights(x8e0_dynamicLights);
@@ -1248,7 +1281,7 @@ void CStateManager::SendScriptMsgAlways(TUniqueId dest, TUniqueId src, EScriptOb
 void CStateManager::SendScriptMsg(TUniqueId src, TEditorId dest, EScriptObjectMessage msg, EScriptObjectState state) {
   // CEntity* ent = GetObjectById(src);
   const auto search = GetIdListForScript(dest);
-  if (search.first == x890_scriptIdMap.cend()) {
+  if (search.first == search.second) {
     return;
   }
 
@@ -1260,21 +1293,26 @@ void CStateManager::SendScriptMsg(TUniqueId src, TEditorId dest, EScriptObjectMe
 }
 
 void CStateManager::FreeScriptObjects(TAreaId aid) {
+  /* Free in editor id order, as the ordered map did; the hash table's slot order is arbitrary */
+  std::vector<std::pair<TEditorId, TUniqueId>> areaIds;
   for (const auto& p : x890_scriptIdMap) {
     if (p.first.AreaNum() == aid) {
-      FreeScriptObject(p.second);
+      areaIds.push_back(p);
     }
   }
+  std::stable_sort(areaIds.begin(), areaIds.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+  for (const auto& p : areaIds) {
+    FreeScriptObject(p.second);
+  }
 
-  std::set<TEditorId> freedObjects;
-  for (auto it = x8a4_loadedScriptObjects.begin(); it != x8a4_loadedScriptObjects.end();) {
-    if (it->first.AreaNum() == aid) {
-      freedObjects.emplace(it->first);
-      it = x8a4_loadedScriptObjects.erase(it);
-      continue;
+  std::vector<TEditorId> freedObjects;
+  x8a4_loadedScriptObjects.EraseIf([&](const auto& p) {
+    if (p.first.AreaNum() != aid) {
+      return false;
     }
-    ++it;
-  }
+    freedObjects.push_back(p.first);
+    return true;
+  });
 
   const CGameArea* area = x850_world->GetGameAreas()[aid].get();
   if (area->IsPostConstructed()) {
@@ -1286,8 +1324,11 @@ void CStateManager::FreeScriptObjects(TAreaId aid) {
     }
   }
 
-  for (const auto& id : freedObjects) {
-    m_incomingConnections.erase(id);
+  if (!freedObjects.empty()) {
+    for (const TEditorId id : freedObjects) {
+      m_incomingConnectionRanges.Erase(id);
+    }
+    CompactIncomingConnections();
   }
 }
 
@@ -1313,8 +1354,8 @@ void CStateManager::FreeScriptObject(TUniqueId id) {
 }
 
 std::pair<const SScriptObjectStream*, TEditorId> CStateManager::GetBuildForScript(TEditorId id) const {
-  const auto search = x8a4_loadedScriptObjects.find(id);
-  if (search == x8a4_loadedScriptObjects.cend()) {
+  const auto* search = x8a4_loadedScriptObjects.FindEntry(id);
+  if (search == nullptr) {
     return {nullptr, kInvalidEditorId};
   }
   return {&search->second, search->first};
@@ -1329,21 +1370,82 @@ TEditorId CStateManager::GetEditorIdForUniqueId(TUniqueId id) const {
 }
 
 TUniqueId CStateManager::GetIdForScript(TEditorId id) const {
-  const auto search = x890_scriptIdMap.find(id);
-  if (search == x890_scriptIdMap.cend()) {
+  const TUniqueId* search = x890_scriptIdMap.Find(id);
+  if (search == nullptr) {
     return kInvalidUniqueId;
   }
-  return search->second;
+  return *search;
 }
 
-std::pair<std::multimap<TEditorId, TUniqueId>::const_iterator, std::multimap<TEditorId, TUniqueId>::const_iterator>
+std::pair<TEditorIdMap<TUniqueId>::const_key_iterator, TEditorIdMap<TUniqueId>::const_key_iterator>
 CStateManager::GetIdListForScript(TEditorId id) const {
-  auto ret = x890_scriptIdMap.equal_range(id);
-  if (ret.first != x890_scriptIdMap.cend() && ret.first->first != id) {
-    ret.first = x890_scriptIdMap.cend();
-    ret.second = x890_scriptIdMap.cend();
+  return x890_scriptIdMap.EqualRange(id);
+}
+
+std::span<const SConnection> CStateManager::GetIncomingConnections(TEditorId id) const {
+  const std::pair<u32, u32>* range = m_incomingConnectionRanges.Find(id);
+  if (range == nullptr) {
+    return {};
   }
-  return ret;
+  return std::span<const SConnection>(m_incomingConnections).subspan(range->first, range->second);
+}
+
+void CStateManager::MergeIncomingConnections() {
+  /* Regenerated objects bring back connections that are already stored; only rebuild for new ones */
+  std::erase_if(m_pendingIncomingConnections, [&](const auto& p) {
+    const std::span<const SConnection> conns = GetIncomingConnections(p.first);
+    return std::binary_search(conns.begin(), conns.end(), p.second);
+  });
+  if (m_pendingIncomingConnections.empty()) {
+    return;
+  }
+
+  /* Stored connections go first so they win over duplicates, like std::set::emplace did */
+  std::vector<std::pair<TEditorId, SConnection>> all;
+  all.reserve(m_incomingConnections.size() + m_pendingIncomingConnections.size());
+  for (const auto& [target, range] : m_incomingConnectionRanges) {
+    for (u32 i = 0; i < range.second; ++i) {
+      all.emplace_back(target, m_incomingConnections[range.first + i]);
+    }
+  }
+  all.insert(all.end(), m_pendingIncomingConnections.begin(), m_pendingIncomingConnections.end());
+  m_pendingIncomingConnections.clear();
+
+  std::stable_sort(all.begin(), all.end(), [](const auto& a, const auto& b) {
+    if (a.first != b.first) {
+      return a.first < b.first;
+    }
+    return a.second < b.second;
+  });
+  all.erase(std::unique(all.begin(), all.end(),
+                        [](const auto& a, const auto& b) {
+                          return a.first == b.first && !(a.second < b.second) && !(b.second < a.second);
+                        }),
+            all.end());
+
+  m_incomingConnections.clear();
+  m_incomingConnections.reserve(all.size());
+  m_incomingConnectionRanges.clear();
+  for (size_t i = 0; i < all.size();) {
+    const TEditorId target = all[i].first;
+    const u32 begin = u32(m_incomingConnections.size());
+    for (; i < all.size() && all[i].first == target; ++i) {
+      m_incomingConnections.push_back(all[i].second);
+    }
+    m_incomingConnectionRanges[target] = {begin, u32(m_incomingConnections.size()) - begin};
+  }
+}
+
+void CStateManager::CompactIncomingConnections() {
+  std::vector<SConnection> conns;
+  conns.reserve(m_incomingConnections.size());
+  for (auto& [target, range] : m_incomingConnectionRanges) {
+    const u32 begin = u32(conns.size());
+    conns.insert(conns.end(), m_incomingConnections.begin() + range.first,
+                 m_incomingConnections.begin() + range.first + range.second);
+    range.first = begin;
+  }
+  m_incomingConnections = std::move(conns);
 }
 
 void CStateManager::LoadScriptObjects(TAreaId aid, CInputStream& in, std::vector<TEditorId>& idsOut) {
@@ -1369,11 +1471,7 @@ void CStateManager::LoadScriptObjects(TAreaId aid, CInputStream& in, std::vector
     idsOut.push_back(id.first);
   }
 
-  for (const auto& pair : m_incomingConnections) {
-    if (auto* ent = ObjectById(GetIdForScript(pair.first))) {
-      ent->SetIncomingConnectionList(&pair.second);
-    }
-  }
+  MergeIncomingConnections();
 }
 
 std::pair<TEditorId, TUniqueId> CStateManager::LoadScriptObject(TAreaId aid, EScriptObjectType type, u32 length,
@@ -1389,11 +1487,7 @@ std::pair<TEditorId, TUniqueId> CStateManager::LoadScriptObject(TAreaId aid, ESc
     const auto msg = EScriptObjectMessage(in.ReadLong());
     const TEditorId target = in.ReadLong();
     // Metaforce Addition
-    if (m_incomingConnections.find(target) == m_incomingConnections.cend()) {
-      m_incomingConnections.emplace(target, std::set<SConnection>());
-    }
-    SConnection inConn{state, msg, id};
-    m_incomingConnections[target].emplace(inConn);
+    m_pendingIncomingConnections.emplace_back(target, SConnection{state, msg, id});
     // End Metaforce Addition
     length -= 12;
     conns.push_back(SConnection{state, msg, target});
@@ -1455,11 +1549,7 @@ std::pair<TEditorId, TUniqueId> CStateManager::GenerateObject(TEditorId eid) {
       CMemoryInStream stream(buf.first + build.first->x4_position, build.first->x8_length);
       auto ret = LoadScriptObject(build.second.AreaNum(), build.first->x0_type, build.first->x8_length, stream);
       // Metaforce Addition
-      if (m_incomingConnections.find(eid) != m_incomingConnections.end()) {
-        if (auto ent = ObjectById(ret.second)) {
-          ent->SetIncomingConnectionList(&m_incomingConnections[eid]);
-        }
-      }
+      MergeIncomingConnections();
       // End Metaforce Addition
       return ret;
     }
@@ -2189,21 +2279,22 @@ void CStateManager::UpdateHintState(float dt) {
 }
 
 void CStateManager::PreThinkObjects(float dt) {
+  m_updateBucketStats = {};
   if (x84c_player->x9f4_deathTime > 0.f) {
     x84c_player->DoPreThink(dt, *this);
-  } else if (x904_gameState == EGameState::SoftPaused) {
-    for (CEntity* ent : GetAllObjectList()) {
-      if (const TCastToPtr<CScriptEffect> effect = ent) {
-        effect->PreThink(dt, *this);
-      }
-    }
-  } else {
-    for (CEntity* ent : GetAllObjectList()) {
-      if (ent != nullptr && !GetCameraObjectList().GetObjectById(ent->GetUniqueId())) {
-        ent->PreThink(dt, *this);
-      }
-    }
+    return;
   }
+
+  const bool softPaused = x904_gameState == EGameState::SoftPaused;
+  m_updateList.ForEach([&](const CEntityUpdateList::SEntry& entry) {
+    if (softPaused ? entry.bucket != EUpdateBucket::Effect : IsUpdateCamera(entry)) {
+      return;
+    }
+    const size_t bucket = size_t(entry.bucket);
+    ++m_updateBucketStats.preThinks[bucket];
+    TimeUpdate(m_timeUpdateBuckets, m_updateBucketStats.preThinkNanos[bucket],
+               [&] { entry.ent->PreThink(dt, *this); });
+  });
 }
 
 void CStateManager::MovePlatforms(float dt) {
@@ -2316,35 +2407,34 @@ void CStateManager::Think(float dt) {
     return;
   }
 
-  if (x904_gameState == EGameState::SoftPaused) {
-    for (CEntity* ent : GetAllObjectList()) {
-      if (const TCastToPtr<CScriptEffect> effect = ent) {
-        effect->Think(dt, *this);
-      }
+  const bool softPaused = x904_gameState == EGameState::SoftPaused;
+  m_updateList.ForEach([&](const CEntityUpdateList::SEntry& entry) {
+    if (softPaused ? entry.bucket != EUpdateBucket::Effect : IsUpdateCamera(entry)) {
+      return;
     }
-  } else {
-    for (CEntity* ent : GetAllObjectList()) {
-      if (const TCastToPtr<CPatterned> ai = ent) {
-        bool doThink = !xf94_29_cinematicPause;
-        if (doThink && ai->GetAreaIdAlways() != kInvalidAreaId) {
-          const CGameArea* area = x850_world->GetAreaAlways(ai->GetAreaIdAlways());
-          float occTime = 0.0f;
-          if (area->IsPostConstructed()) {
-            occTime = area->GetPostConstructed()->x10e4_occludedTime;
-          }
-          if (occTime > 5.f) {
-            doThink = false;
-          }
+    if (!softPaused && entry.bucket == EUpdateBucket::Patterned) {
+      bool doThink = !xf94_29_cinematicPause;
+      const TAreaId aid = entry.ent->GetAreaIdAlways();
+      if (doThink && aid != kInvalidAreaId) {
+        const CGameArea* area = x850_world->GetAreaAlways(aid);
+        float occTime = 0.0f;
+        if (area->IsPostConstructed()) {
+          occTime = area->GetPostConstructed()->x10e4_occludedTime;
         }
-        if (!doThink) {
-          continue;
+        if (occTime > 5.f) {
+          doThink = false;
         }
       }
-      if (!GetCameraObjectList().GetObjectById(ent->GetUniqueId())) {
-        ent->Think(dt, *this);
+      if (!doThink) {
+        ++m_updateBucketStats.skippedAi;
+        return;
       }
     }
-  }
+    const size_t bucket = size_t(entry.bucket);
+    ++m_updateBucketStats.thinks[bucket];
+    TimeUpdate(m_timeUpdateBuckets, m_updateBucketStats.thinkNanos[bucket],
+               [&] { entry.ent->Think(dt, *this); });
+  });
 }
 
 void CStateManager::PostUpdatePlayer(float dt) { x84c_player->PostUpdate(dt, *this); }
@@ -2487,14 +2577,7 @@ const CObjectList* CStateManager::GetObjectListById(EGameObjectList type) const
 void CStateManager::RemoveObject(TUniqueId uid) {
   if (CEntity* ent = GetAllObjectList().GetValidObjectById(uid)) {
     if (ent->GetEditorId() != kInvalidEditorId) {
-      const auto search = x890_scriptIdMap.equal_range(ent->GetEditorId());
-      for (auto it = search.first; it != search.second;) {
-        if (it->second == uid) {
-          it = x890_scriptIdMap.erase(it);
-          continue;
-        }
-        ++it;
-      }
+      x890_scriptIdMap.EraseFirst(ent->GetEditorId(), [uid](TUniqueId id) { return id == uid; });
     }
     if (ent->GetAreaIdAlways() != kInvalidAreaId) {
       CGameArea* area = x850_world->GetArea(ent->GetAreaIdAlways());
@@ -2509,6 +2592,7 @@ void CStateManager::RemoveObject(TUniqueId uid) {
   for (auto& list : x808_objLists) {
     list->RemoveObject(uid);
   }
+  m_updateList.RemoveObject(uid);
 }
 
 void CStateManager::UpdateRoomAcoustics(TAreaId aid) {
@@ -2639,11 +2723,12 @@ std::optional<zeus::CAABox> CStateManager::CalculateObjectBounds(const CActor& a
 
 void CStateManager::AddObject(CEntity& ent) {
   if (ent.GetEditorId() != kInvalidEditorId) {
-    x890_scriptIdMap.insert(std::make_pair(ent.GetEditorId(), ent.GetUniqueId()));
+    x890_scriptIdMap.InsertMulti(ent.GetEditorId(), ent.GetUniqueId());
   }
   for (auto& list : x808_objLists) {
     list->AddObject(ent);
   }
+  m_updateList.AddObject(ent);
 
   if (ent.GetAreaIdAlways() == kInvalidAreaId && x84c_player && ent.GetUniqueId() != x84c_player->GetUniqueId()) {
     ent.x4_areaId = x84c_player->GetAreaIdAlways();
@@ -2692,6 +2777,16 @@ CRayCastResult CStateManager::RayWorldIntersection(TUniqueId& idOut, const zeus:
   return CGameCollision::RayWorldIntersection(*this, idOut, pos, dir, length, filter, list);
 }
 
+void CStateManager::RayStaticIntersectionBatch(std::span<const SRayCastQuery> rays,
+                                               std::span<CRayCastResult> results) const {
+  CGameCollision::RayStaticIntersectionBatch(*this, rays, results);
+}
+
+void CStateManager::RayWorldIntersectionBatch(std::span<const SRayCastQuery> rays, std::span<CRayCastResult> results,
+                                              std::span<TUniqueId> idsOut, const EntityList& list) const {
+  CGameCollision::RayWorldIntersectionBatch(*this, rays, results, idsOut, list);
+}
+
 zeus::CVector3f CStateManager::Random2f(float scaleMin, float scaleMax) {
   zeus::CVector3f ret(x900_activeRandom->Float() - 0.5f, x900_activeRandom->Float() - 0.5f, 0.f);
   if (std::fabs(ret.x()) < 0.001f) {
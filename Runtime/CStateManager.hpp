@@ -5,6 +5,7 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,11 +14,14 @@
 #include "Runtime/CRandom16.hpp"
 #include "Runtime/CSortedLists.hpp"
 #include "Runtime/CToken.hpp"
+#include "Runtime/TEditorIdMap.hpp"
 #include "Runtime/rstl.hpp"
 #include "Runtime/Camera/CCameraFilter.hpp"
 #include "Runtime/Camera/CCameraManager.hpp"
 #include "Runtime/Camera/CCameraShakeData.hpp"
+#include "Runtime/Collision/CRayCastResult.hpp"
 #include "Runtime/GameObjectLists.hpp"
+#include "Runtime/Graphics/CLightGrid.hpp"
 #include "Runtime/Input/CFinalInput.hpp"
 #include "Runtime/Input/CRumbleManager.hpp"
 #include "Runtime/Weapon/CWeaponMgr.hpp"
@@ -73,6 +77,15 @@ struct SOnScreenTex {
   zeus::CVector2i xc_extent;
 };
 
+/* Filled in by PreThinkObjects and Think every frame; times are only taken while the overlay is shown */
+struct SUpdateBucketStats {
+  std::array<u32, size_t(EUpdateBucket::MAX)> preThinks{};
+  std::array<u32, size_t(EUpdateBucket::MAX)> thinks{};
+  std::array<u64, size_t(EUpdateBucket::MAX)> preThinkNanos{};
+  std::array<u64, size_t(EUpdateBucket::MAX)> thinkNanos{};
+  u32 skippedAi = 0;
+};
+
 enum class EStateManagerTransition { InGame, MapScreen, PauseGame, LogBook, SaveGame, MessageScreen };
 
 enum class EThermalDrawFlag { Hot, Cold, Bypass };
@@ -135,8 +148,9 @@ private:
   CActorModelParticles* x884_actorModelParticles = nullptr;
   CRumbleManager* x88c_rumbleManager = nullptr;
 
-  std::multimap<TEditorId, TUniqueId> x890_scriptIdMap;
-  std::map<TEditorId, SScriptObjectStream> x8a4_loadedScriptObjects;
+  /* Reserved for kMaxEntities up front, so AddObject never rehashes under a running GetIdListForScript walk */
+  TEditorIdMap<TUniqueId> x890_scriptIdMap;
+  TEditorIdMap<SScriptObjectStream> x8a4_loadedScriptObjects;
 
   std::shared_ptr<CPlayerState> x8b8_playerState;
   std::shared_ptr<CScriptMailbox> x8bc_mailbox;
@@ -152,6 +166,7 @@ private:
   u32 x8dc_objectDrawToken = 0;
 
   std::vector<CLight> x8e0_dynamicLights;
+  CLightGrid m_dynamicLightGrid;
 
   TLockedToken<CTexture> x8f0_shadowTex; /* DefaultShadow in MiscData */
   CRandom16 x8fc_random;
@@ -208,10 +223,21 @@ private:
   bool xf94_30_fullThreat : 1 = false;
 
   bool m_warping = false;
-  std::map<TEditorId, std::set<SConnection>> m_incomingConnections;
+  /* Incoming connections of every loaded script object, sorted by target then source and stored contiguously.
+   * Connections found while loading are staged in m_pendingIncomingConnections and merged once per load. */
+  std::vector<SConnection> m_incomingConnections;
+  TEditorIdMap<std::pair<u32, u32>> m_incomingConnectionRanges;
+  std::vector<std::pair<TEditorId, SConnection>> m_pendingIncomingConnections;
+  void MergeIncomingConnections();
+  void CompactIncomingConnections();
 
   bool m_logScripting = false;
   std::optional<CVarValueReference<bool>> m_logScriptingReference;
+  CEntityUpdateList m_updateList;
+  SUpdateBucketStats m_updateBucketStats;
+  bool m_timeUpdateBuckets = false;
+  std::optional<CVarValueReference<bool>> m_timeUpdateBucketsReference;
+
   void UpdateThermalVisor();
   static void RendererDrawCallback(void*, void*, int);
 
@@ -245,6 +271,7 @@ public:
   void CacheReflection();
   bool CanCreateProjectile(TUniqueId, EWeaponType, int) const;
   const std::vector<CLight>& GetDynamicLightList() const { return x8e0_dynamicLights; }
+  const CLightGrid& GetDynamicLightGrid() const { return m_dynamicLightGrid; }
   void BuildDynamicLightListForWorld();
   void DrawDebugStuff() const;
   void RenderCamerasAndAreaLights();
@@ -274,9 +301,10 @@ public:
   std::pair<const SScriptObjectStream*, TEditorId> GetBuildForScript(TEditorId) const;
   TEditorId GetEditorIdForUniqueId(TUniqueId) const;
   TUniqueId GetIdForScript(TEditorId) const;
-  std::pair<std::multimap<TEditorId, TUniqueId>::const_iterator, std::multimap<TEditorId, TUniqueId>::const_iterator>
+  std::pair<TEditorIdMap<TUniqueId>::const_key_iterator, TEditorIdMap<TUniqueId>::const_key_iterator>
       GetIdListForScript(TEditorId) const;
-  std::multimap<TEditorId, TUniqueId>::const_iterator GetIdListEnd() const { return x890_scriptIdMap.cend(); }
+  TEditorIdMap<TUniqueId>::const_key_iterator GetIdListEnd() const { return {}; }
+  std::span<const SConnection> GetIncomingConnections(TEditorId) const;
   void LoadScriptObjects(TAreaId, CInputStream& in, std::vector<TEditorId>& idsOut);
   void InitializeScriptObjects(const std::vector<TEditorId>& objIds);
   std::pair<TEditorId, TUniqueId> LoadScriptObject(TAreaId, EScriptObjectType, u32, CInputStream& in);
@@ -315,6 +343,8 @@ public:
   void PreThinkObjects(float dt);
   void MovePlatforms(float dt);
   void MoveActors(float dt);
+  const CEntityUpdateList& GetUpdateList() const { return m_updateList; }
+  const SUpdateBucketStats& GetUpdateBucketStats() const { return m_updateBucketStats; }
   void CrossTouchActors();
   void Think(float dt);
   void PostUpdatePlayer(float dt);
@@ -348,6 +378,10 @@ public:
                                        const CMaterialFilter& filter) const;
   CRayCastResult RayWorldIntersection(TUniqueId& idOut, const zeus::CVector3f& pos, const zeus::CVector3f& dir,
                                       float length, const CMaterialFilter& filter, const EntityList& list) const;
+  /* Casts every ray in one pass, see CGameCollision::RayWorldIntersectionBatch */
+  void RayStaticIntersectionBatch(std::span<const SRayCastQuery> rays, std::span<CRayCastResult> results) const;
+  void RayWorldIntersectionBatch(std::span<const SRayCastQuery> rays, std::span<CRayCastResult> results,
+                                 std::span<TUniqueId> idsOut, const EntityList& list) const;
   void UpdateObjectInLists(CEntity&);
   TUniqueId AllocateUniqueId();
   void DeferStateTransition(EStateManagerTransition t);
@@ -1,6 +1,7 @@
 #include "Runtime/Camera/CBallCamera.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 
 #include "Runtime/CStateManager.hpp"
@@ -1545,29 +1546,34 @@ zeus::CVector3f CBallCamera::GetFailsafeSplinePoint(const std::vector<zeus::CVec
 }
 
 bool CBallCamera::CheckFailsafeFromMorphBallState(CStateManager& mgr) const {
-  TUniqueId xbb8 = kInvalidUniqueId;
   float curT = 0.f;
   EntityList nearList;
-  rstl::reserved_vector<CRayCastResult, 6> resultsA;
-  rstl::reserved_vector<CRayCastResult, 6> resultsB;
+  rstl::reserved_vector<SRayCastQuery, 12> queries;
+  std::array<bool, 6> tested{};
   while (curT < 6.f) {
     zeus::CVector3f pointA = GetFailsafeSplinePoint(x47c_failsafeState->x90_splinePoints, curT / 6.f);
     zeus::CVector3f pointB = GetFailsafeSplinePoint(x47c_failsafeState->x90_splinePoints, (1.f + curT) / 6.f);
     zeus::CVector3f pointDelta = pointB - pointA;
     if (pointDelta.magnitude() > 0.1f) {
-      resultsA.push_back(mgr.RayWorldIntersection(xbb8, pointA, pointDelta.normalized(), pointDelta.magnitude(),
-                                                  BallCameraFilter, nearList));
-      resultsB.push_back(mgr.RayWorldIntersection(xbb8, pointB, -pointDelta.normalized(), pointDelta.magnitude(),
-                                                  BallCameraFilter, nearList));
-    } else {
-      resultsA.push_back({});
-      resultsB.push_back({});
+      tested[size_t(curT)] = true;
+      queries.push_back({pointA, pointDelta.normalized(), pointDelta.magnitude(), BallCameraFilter});
+      queries.push_back({pointB, -pointDelta.normalized(), pointDelta.magnitude(), BallCameraFilter});
     }
     curT += 1.f;
   }
-  for (size_t i = 0; i < resultsA.size(); ++i) {
-    const CRayCastResult& resA = resultsA[i];
-    const CRayCastResult& resB = resultsB[i];
+
+  /* Both directions of every spline segment go out as one batch */
+  std::array<CRayCastResult, 12> results;
+  mgr.RayWorldIntersectionBatch({queries.data(), queries.size()}, std::span(results).first(queries.size()), {},
+                                nearList);
+
+  size_t resultIdx = 0;
+  for (size_t i = 0; i < tested.size(); ++i) {
+    if (!tested[i]) {
+      continue;
+    }
+    const CRayCastResult& resA = results[resultIdx++];
+    const CRayCastResult& resB = results[resultIdx++];
     if (resA.IsValid()) {
       zeus::CVector3f separation = resA.GetPoint() - resB.GetPoint();
       if (separation.magnitude() < 0.00001f) {
@@ -172,6 +172,8 @@ bool CActorLights::BuildAreaLightList(const CStateManager& mgr, const CGameArea&
       x298_30_layer2 ? area.GetPostConstructed()->x80_lightsB : area.GetPostConstructed()->x60_lightsA;
   const std::vector<CLight>& gfxLightList =
       x298_30_layer2 ? area.GetPostConstructed()->x90_gfxLightsB : area.GetPostConstructed()->x70_gfxLightsA;
+  const CLightGrid& lightGrid =
+      x298_30_layer2 ? area.GetPostConstructed()->m_lightGridB : area.GetPostConstructed()->m_lightGridA;
   float worldLightingLevel = area.GetPostConstructed()->x1128_worldLightingLevel;
   x298_26_hasAreaLights = lightList.size() != 0;
   if (!x298_26_hasAreaLights || !x298_28_inArea) {
@@ -233,18 +235,21 @@ bool CActorLights::BuildAreaLightList(const CStateManager& mgr, const CGameArea&
     sets[2].SetTestPoint(pvs->GetVisOctree(), localVec);
   }
 
-  std::vector<SLightValue> valList;
-  valList.reserve(lightList.size());
+  /* Only lights whose sphere can reach the bounds are visited, still in list order */
+  thread_local std::vector<u16> candidates;
+  lightGrid.Query(aabb, candidates);
 
-  auto lightIt = lightList.begin();
-  int lightIdx = 0;
-  for (const CLight& light : gfxLightList) {
+  std::vector<SLightValue> valList;
+  valList.reserve(candidates.size());
+  for (const u16 candidate : candidates) {
+    const int lightIdx = candidate;
+    const CLight& light = gfxLightList[lightIdx];
     if (light.GetType() == ELightType::LocalAmbient) {
       /* Take ambient here */
       x288_ambientColor = light.GetNormalIndependentLightingAtPoint(vec);
     } else {
       EPVSVisSetState visible = EPVSVisSetState::OutOfBounds;
-      if (area.GetAreaVisSet() && lightIt->DoesCastShadows()) {
+      if (area.GetAreaVisSet() && lightList[lightIdx].DoesCastShadows()) {
         u32 pvsIdx = use2ndLayer ? area.Get2ndPVSLightFeature(lightIdx) : area.Get1stPVSLightFeature(lightIdx);
         visible = sets[0].GetVisible(pvsIdx);
         if (visible != EPVSVisSetState::OutOfBounds)
@@ -265,8 +270,6 @@ bool CActorLights::BuildAreaLightList(const CStateManager& mgr, const CGameArea&
         }
       }
     }
-    ++lightIt;
-    ++lightIdx;
   }
 
   /* Sort lights most intense to least intense */
@@ -390,8 +393,14 @@ void CActorLights::BuildDynamicLightList(const CStateManager& mgr, const zeus::C
   x299_26_ambientOnly = false;
   x144_dynamicLights.clear();
 
+  /* Candidates come back in list order, so picking the first or nearest lights gives the same result */
+  const std::vector<CLight>& lights = mgr.GetDynamicLightList();
+  thread_local std::vector<u16> candidates;
+  mgr.GetDynamicLightGrid().Query(aabb, candidates);
+
   if (!x29a_findNearestDynamicLights) {
-    for (const CLight& light : mgr.GetDynamicLightList()) {
+    for (const u16 candidate : candidates) {
+      const CLight& light = lights[candidate];
       zeus::CSphere sphere(light.GetPosition(), light.GetRadius());
       if (aabb.intersects(sphere))
         x144_dynamicLights.push_back(light);
@@ -402,7 +411,8 @@ void CActorLights::BuildDynamicLightList(const CStateManager& mgr, const zeus::C
     const CLight* addedLights[8] = {};
     for (int i = 0; i < x2bc_maxDynamicLights && i < 8; ++i) {
       float minRad = FLT_MAX;
-      for (const CLight& light : mgr.GetDynamicLightList()) {
+      for (const u16 candidate : candidates) {
+        const CLight& light = lights[candidate];
         zeus::CSphere sphere(light.GetPosition(), light.GetRadius());
         float intRadius = aabb.intersectionRadius(sphere);
         if (intRadius >= 0.f && intRadius < minRad) {
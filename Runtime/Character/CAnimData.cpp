@@ -1,5 +1,6 @@
 #include "Runtime/Character/CAnimData.hpp"
 
+#include "Runtime/CJobPool.hpp"
 #include "Runtime/CStateManager.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
 #include "Runtime/rstl.hpp"
@@ -35,6 +36,8 @@ rstl::reserved_vector<CInt32POINode, 16> CAnimData::g_Int32POINodes;
 rstl::reserved_vector<CParticlePOINode, 20> CAnimData::g_ParticlePOINodes;
 rstl::reserved_vector<CSoundPOINode, 20> CAnimData::g_SoundPOINodes;
 rstl::reserved_vector<CInt32POINode, 16> CAnimData::g_TransientInt32POINodes;
+std::vector<CAnimData*> CAnimData::g_PoseBatch;
+bool CAnimData::g_PoseBatchOpen = false;
 
 void CAnimData::FreeCache() {}
 
@@ -92,6 +95,12 @@ CAnimData::CAnimData(CAssetId id, const CCharacterInfo& character, int defaultAn
   }
 }
 
+CAnimData::~CAnimData() {
+  if (m_poseQueued) {
+    std::erase(g_PoseBatch, this);
+  }
+}
+
 void CAnimData::SetParticleEffectState(std::string_view effectName, bool active, CStateManager& mgr) {
   auto search = std::find_if(xc_charInfo.x98_effects.begin(), xc_charInfo.x98_effects.end(),
                              [effectName](const auto& v) { return v.first == effectName; });
@@ -570,6 +579,13 @@ void CAnimData::DrawSkinnedModel(CSkinnedModel& model, const CModelFlags& flags)
 
 void CAnimData::PreRender() {
   if (!x220_31_poseCached) {
+    if (g_PoseBatchOpen) {
+      if (!m_poseQueued) {
+        m_poseQueued = true;
+        g_PoseBatch.push_back(this);
+      }
+      return;
+    }
     RecalcPoseBuilder(nullptr);
     x220_31_poseCached = true;
     x220_30_poseBuilt = false;
@@ -589,6 +605,33 @@ void CAnimData::BuildPose() {
   }
 }
 
+void CAnimData::BeginPoseBatch() { g_PoseBatchOpen = true; }
+
+/* Runs on a job thread; only touches this character's tree, pose builder and pose */
+void CAnimData::EvaluateQueuedPose() {
+  if (!x220_31_poseCached) {
+    RecalcPoseBuilder(nullptr);
+    x220_31_poseCached = true;
+  }
+  x2fc_poseBuilder.BuildNoScale(x224_pose);
+  x220_30_poseBuilt = true;
+}
+
+void CAnimData::FlushPoseBatch() {
+  OPTICK_EVENT();
+  g_PoseBatchOpen = false;
+  CJobPool::Shared().ParallelFor(g_PoseBatch.size(), 2, [](size_t begin, size_t end) {
+    OPTICK_EVENT("CAnimData::FlushPoseBatch job");
+    for (size_t i = begin; i < end; ++i) {
+      g_PoseBatch[i]->EvaluateQueuedPose();
+    }
+  });
+  for (CAnimData* data : g_PoseBatch) {
+    data->m_poseQueued = false;
+  }
+  g_PoseBatch.clear();
+}
+
 void CAnimData::PrimitiveSetToTokenVector(const std::set<CPrimitive>& primSet, std::vector<CToken>& tokensOut,
                                           bool preLock) {
   tokensOut.reserve(primSet.size());
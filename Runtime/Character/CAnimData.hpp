@@ -132,6 +132,7 @@ private:
   bool x220_29_animationJustStarted : 1 = false;
   bool x220_30_poseBuilt : 1 = false;
   bool x220_31_poseCached : 1 = false;
+  bool m_poseQueued = false;
   CPoseAsTransforms x224_pose;
   CHierarchyPoseBuilder x2fc_poseBuilder;
 
@@ -143,6 +144,10 @@ private:
   static rstl::reserved_vector<CParticlePOINode, 20> g_ParticlePOINodes;
   static rstl::reserved_vector<CSoundPOINode, 20> g_SoundPOINodes;
   static rstl::reserved_vector<CInt32POINode, 16> g_TransientInt32POINodes;
+  static std::vector<CAnimData*> g_PoseBatch;
+  static bool g_PoseBatchOpen;
+
+  void EvaluateQueuedPose();
 
 public:
   CAnimData(CAssetId, const CCharacterInfo& character, int defaultAnim, int charIdx, bool loop,
@@ -150,6 +155,7 @@ public:
             const std::optional<TToken<CSkinnedModelWithAvgNormals>>& iceModel,
             const std::weak_ptr<CAnimSysContext>& ctx, std::shared_ptr<CAnimationManager> animMgr,
             std::shared_ptr<CTransitionManager> transMgr, TLockedToken<CCharacterFactory> charFactory);
+  ~CAnimData();
 
   void SetParticleEffectState(std::string_view effectName, bool active, CStateManager& mgr);
   void InitializeEffects(CStateManager& mgr, TAreaId aId, const zeus::CVector3f& scale);
@@ -200,6 +206,10 @@ public:
   static void DrawSkinnedModel(CSkinnedModel& model, const CModelFlags& flags);
   void PreRender();
   void BuildPose();
+  /* While a pose batch is open, PreRender queues the pose instead of evaluating it inline.
+   * FlushPoseBatch closes the batch and evaluates every queued pose across the job pool. */
+  static void BeginPoseBatch();
+  static void FlushPoseBatch();
   const CPoseAsTransforms& GetPose() const { return x224_pose; }
   static void PrimitiveSetToTokenVector(const std::set<CPrimitive>& primSet, std::vector<CToken>& tokensOut,
                                         bool preLock);
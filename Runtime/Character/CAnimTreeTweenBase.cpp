@@ -20,7 +20,7 @@ void CAnimTreeTweenBase::VGetWeightedReaders(
 
 void CAnimTreeTweenBase::VGetSegStatementSet(const CSegIdList& list, CSegStatementSet& setOut) const {
   float w = GetBlendingWeight();
-  static int sStack = 0;
+  thread_local int sStack = 0;
   ++sStack;
   if (w >= 1.f) {
     x18_b->VGetSegStatementSet(list, setOut);
@@ -57,7 +57,7 @@ void CAnimTreeTweenBase::VGetSegStatementSet(const CSegIdList& list, CSegStateme
 void CAnimTreeTweenBase::VGetSegStatementSet(const CSegIdList& list, CSegStatementSet& setOut,
                                              const CCharAnimTime& time) const {
   float w = GetBlendingWeight();
-  static int sStack = 0;
+  thread_local int sStack = 0;
   ++sStack;
   if (w >= 1.f) {
     x18_b->VGetSegStatementSet(list, setOut, time);
@@ -80,6 +80,14 @@ void CFBStreamedAnimReaderTotals::Initialize(const CFBStreamedCompression& sourc
   }
 }
 
+void CFBStreamedAnimReaderTotals::InitializeFromCheckpoint(const CFBStreamedCompression& source, u32 checkpoint) {
+  /* Segment ids and translation flags don't change between keys, only the totals do */
+  const size_t stride = size_t(x24_boneChanCount) * 8;
+  std::memcpy(x4_cumulativeInts32, source.m_checkpointTotals.data() + stride * checkpoint, stride * sizeof(s32));
+  x1c_curKey = checkpoint * CFBStreamedCompression::kSeekCheckpointInterval;
+  x20_calculated = false;
+}
+
 CFBStreamedAnimReaderTotals::CFBStreamedAnimReaderTotals(const CFBStreamedCompression& source) {
   const CFBStreamedCompression::Header& header = source.MainHeader();
   x14_rotDiv = header.rotDiv;
@@ -212,10 +220,14 @@ void CFBStreamedPairOfTotals::SetTime(CBitLevelLoader& loader, const CCharAnimTi
     curTime += interval;
   }
 
-  if (prior != -1 && u32(prior) < Prior().x1c_curKey) {
-    Prior().Initialize(*x0_source);
-    Next().Initialize(*x0_source);
-    loader.Reset();
+  /* Seeking backwards, or further ahead than one checkpoint interval, restarts from the last checkpoint
+   * at or before the prior key instead of replaying every delta from key 0 */
+  if (prior != -1 && (u32(prior) < Prior().x1c_curKey ||
+                      u32(prior) >= Next().x1c_curKey + CFBStreamedCompression::kSeekCheckpointInterval)) {
+    const u32 checkpoint = x0_source->GetSeekCheckpoint(u32(prior));
+    Prior().InitializeFromCheckpoint(*x0_source, checkpoint);
+    Next().InitializeFromCheckpoint(*x0_source, checkpoint);
+    loader.SetCurBit(x0_source->GetSeekCheckpointBit(checkpoint));
   }
 
   if (prior != -1 && next == -1) {
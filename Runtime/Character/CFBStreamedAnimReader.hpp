@@ -26,6 +26,7 @@ public:
 };
 
 class CFBStreamedAnimReaderTotals {
+  friend class CFBStreamedCompression;
   friend class CSegIdToIndexConverter;
   friend class CFBStreamedPairOfTotals;
   friend class CFBStreamedAnimReader;
@@ -44,6 +45,8 @@ class CFBStreamedAnimReaderTotals {
 public:
   explicit CFBStreamedAnimReaderTotals(const CFBStreamedCompression& source);
   void Initialize(const CFBStreamedCompression& source);
+  /* Same as Initialize followed by replaying up to the checkpoint's key */
+  void InitializeFromCheckpoint(const CFBStreamedCompression& source, u32 checkpoint);
   void IncrementInto(CBitLevelLoader& loader, const CFBStreamedCompression& source, CFBStreamedAnimReaderTotals& dest);
   void CalculateDown();
   bool IsCalculated() const { return x20_calculated; }
@@ -78,6 +81,7 @@ class CBitLevelLoader {
 public:
   explicit CBitLevelLoader(const void* data) : m_data(reinterpret_cast<const u8*>(data)) {}
   void Reset() { m_bitIdx = 0; }
+  void SetCurBit(size_t bit) { m_bitIdx = bit; }
   u32 LoadUnsigned(u8 q);
   s32 LoadSigned(u8 q);
   bool LoadBool();
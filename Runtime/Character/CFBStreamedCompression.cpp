@@ -32,6 +32,7 @@ CFBStreamedCompression::CFBStreamedCompression(CInputStream& in, IObjectStore& o
     x8_evntToken = objStore.GetObj(SObjectTag{FOURCC('EVNT'), x4_evnt});
 
   x10_averageVelocity = CalculateAverageVelocity(GetPerChannelHeaders());
+  BuildSeekCheckpoints();
 }
 
 const u32* CFBStreamedCompression::GetTimes() const { return xc_rotsAndOffs.get() + 9; }
@@ -271,4 +272,32 @@ float CFBStreamedCompression::CalculateAverageVelocity(const u8* chans) const {
   return accumMag / GetAnimationDuration().GetSeconds();
 }
 
+void CFBStreamedCompression::BuildSeekCheckpoints() {
+  const u8* chans = GetPerChannelHeaders();
+  const u32 boneChanCount = ReadValue<u32>(chans);
+  u32 keyCount = 0;
+  if (boneChanCount != 0) {
+    keyCount = m_pc ? ReadValue<u32>(chans + 0x8) : ReadValue<u16>(chans + 0x8);
+  }
+
+  const size_t stride = size_t(boneChanCount) * 8;
+  const u32 checkpointCount = keyCount / kSeekCheckpointInterval + 1;
+  m_checkpointTotals.resize(stride * checkpointCount);
+  m_checkpointBits.resize(checkpointCount);
+
+  CBitLevelLoader loader(GetBitstreamPointer());
+  CFBStreamedAnimReaderTotals totals(*this);
+  for (u32 key = 0;; ++key) {
+    if (key % kSeekCheckpointInterval == 0) {
+      const u32 checkpoint = key / kSeekCheckpointInterval;
+      std::memcpy(m_checkpointTotals.data() + stride * checkpoint, totals.x4_cumulativeInts32, stride * sizeof(s32));
+      m_checkpointBits[checkpoint] = u32(loader.GetCurBit());
+    }
+    if (key == keyCount) {
+      break;
+    }
+    totals.IncrementInto(loader, *this, totals);
+  }
+}
+
 } // namespace metaforce
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -51,6 +52,9 @@ public:
     }
   };
 
+  /* Keys between seek checkpoints, so a seek replays at most this many deltas */
+  static constexpr u32 kSeekCheckpointInterval = 16;
+
 private:
   bool m_pc;
   u32 x0_scratchSize;
@@ -59,11 +63,15 @@ private:
   std::unique_ptr<u32[]> xc_rotsAndOffs;
   float x10_averageVelocity;
   zeus::CVector3f x14_rootOffset;
+  /* Absolute channel totals and bitstream position every kSeekCheckpointInterval keys, starting at key 0 */
+  std::vector<s32> m_checkpointTotals;
+  std::vector<u32> m_checkpointBits;
 
   u8* ReadBoneChannelDescriptors(u8* out, CInputStream& in) const;
   u32 ComputeBitstreamWords(const u8* chans) const;
   std::unique_ptr<u32[]> GetRotationsAndOffsets(u32 words, CInputStream& in) const;
   float CalculateAverageVelocity(const u8* chans) const;
+  void BuildSeekCheckpoints();
 
 public:
   explicit CFBStreamedCompression(CInputStream& in, IObjectStore& objStore, bool pc);
@@ -71,6 +79,11 @@ public:
   const u32* GetTimes() const;
   const u8* GetPerChannelHeaders() const;
   const u8* GetBitstreamPointer() const;
+  /* Last checkpoint at or before key */
+  u32 GetSeekCheckpoint(u32 key) const {
+    return std::min(key / kSeekCheckpointInterval, u32(m_checkpointBits.size()) - 1);
+  }
+  u32 GetSeekCheckpointBit(u32 checkpoint) const { return m_checkpointBits[checkpoint]; }
   bool IsLooping() const { return MainHeader().looping; }
   CCharAnimTime GetAnimationDuration() const { return MainHeader().duration; }
   float GetAverageVelocity() const { return x10_averageVelocity; }
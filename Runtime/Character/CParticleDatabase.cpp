@@ -1,5 +1,8 @@
 #include "Runtime/Character/CParticleDatabase.hpp"
 
+#include <array>
+#include <utility>
+
 #include "Runtime/CSimplePool.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
 #include "Runtime/Character/CCharLayoutInfo.hpp"
@@ -79,20 +82,19 @@ void CParticleDatabase::DeleteAllLights(CStateManager& mgr) {
   DeleteAllLightsForParticleDB(mgr, xa0_lastDraw);
 }
 
-void CParticleDatabase::UpdateParticleGenDB(float dt, const CPoseAsTransforms& pose, const CCharLayoutInfo& charInfo,
-                                            const zeus::CTransform& xf, const zeus::CVector3f& scale,
-                                            CStateManager& stateMgr, DrawMap& map, bool deleteIfDone) {
-  for (auto it = map.begin(); it != map.end();) {
+void CParticleDatabase::PrepareParticleGenDB(const CPoseAsTransforms& pose, const CCharLayoutInfo& charInfo,
+                                             const zeus::CTransform& xf, const zeus::CVector3f& scale,
+                                             CStateManager& stateMgr, DrawMap& map,
+                                             std::vector<DrawMap::iterator>& toUpdate) {
+  for (auto it = map.begin(); it != map.end(); ++it) {
     CParticleGenInfo& info = *it->second;
     if (info.GetIsActive()) {
       if (info.GetType() == EParticleGenType::Normal) {
         const CSegId segId = charInfo.GetSegIdFromString(info.GetLocatorName());
         if (segId.IsInvalid()) {
-          ++it;
           continue;
         }
         if (!pose.ContainsDataFor(segId)) {
-          ++it;
           continue;
         }
         const zeus::CVector3f& off = pose.GetOffset(segId);
@@ -164,22 +166,29 @@ void CParticleDatabase::UpdateParticleGenDB(float dt, const CPoseAsTransforms& p
       }
     }
 
-    info.Update(dt, stateMgr);
+    toUpdate.push_back(it);
+  }
+}
+
+void CParticleDatabase::FinishParticleGenDB(float dt, CStateManager& stateMgr, DrawMap& map,
+                                            std::span<const DrawMap::iterator> updated, bool deleteIfDone) {
+  for (const DrawMap::iterator& it : updated) {
+    CParticleGenInfo& info = *it->second;
+    info.UpdateLight(stateMgr);
 
     if (!info.GetIsActive()) {
       if (!info.HasActiveParticles() && info.GetCurrentTime() - info.GetFinishTime() > 5.f && deleteIfDone) {
         info.DeleteLight(stateMgr);
-        it = map.erase(it);
+        map.erase(it);
         continue;
       }
     } else if (info.IsSystemDeletable()) {
       info.DeleteLight(stateMgr);
-      it = map.erase(it);
+      map.erase(it);
       continue;
     }
 
     info.OffsetTime(dt);
-    ++it;
   }
 }
 
@@ -188,12 +197,30 @@ void CParticleDatabase::Update(float dt, const CPoseAsTransforms& pose, const CC
   if (!xb4_24_updatesEnabled)
     return;
 
-  UpdateParticleGenDB(dt, pose, charInfo, xf, scale, stateMgr, x3c_rendererDrawLoop, true);
-  UpdateParticleGenDB(dt, pose, charInfo, xf, scale, stateMgr, x50_firstDrawLoop, true);
-  UpdateParticleGenDB(dt, pose, charInfo, xf, scale, stateMgr, x64_lastDrawLoop, true);
-  UpdateParticleGenDB(dt, pose, charInfo, xf, scale, stateMgr, x78_rendererDraw, false);
-  UpdateParticleGenDB(dt, pose, charInfo, xf, scale, stateMgr, x8c_firstDraw, false);
-  UpdateParticleGenDB(dt, pose, charInfo, xf, scale, stateMgr, xa0_lastDraw, false);
+  const std::array<std::pair<DrawMap*, bool>, 6> maps{{
+      {&x3c_rendererDrawLoop, true},
+      {&x50_firstDrawLoop, true},
+      {&x64_lastDrawLoop, true},
+      {&x78_rendererDraw, false},
+      {&x8c_firstDraw, false},
+      {&xa0_lastDraw, false},
+  }};
+
+  /* Position every system first, then update them as one batch so independent ones can run in parallel */
+  std::array<std::vector<DrawMap::iterator>, 6> toUpdate;
+  std::vector<CParticleGen*> systems;
+  for (size_t i = 0; i < maps.size(); ++i) {
+    PrepareParticleGenDB(pose, charInfo, xf, scale, stateMgr, *maps[i].first, toUpdate[i]);
+    for (const DrawMap::iterator& it : toUpdate[i]) {
+      systems.push_back(&it->second->GetSystem());
+    }
+  }
+
+  CParticleGen::UpdateBatch(systems, dt);
+
+  for (size_t i = 0; i < maps.size(); ++i) {
+    FinishParticleGenDB(dt, stateMgr, *maps[i].first, toUpdate[i], maps[i].second);
+  }
 
   xb4_25_anySystemsDrawnWithModel =
       (x50_firstDrawLoop.size() || x64_lastDrawLoop.size() || x8c_firstDraw.size() || xa0_lastDraw.size());
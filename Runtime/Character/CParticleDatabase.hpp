@@ -2,7 +2,9 @@
 
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "Runtime/CToken.hpp"
 #include "Runtime/Character/CCharacterInfo.hpp"
@@ -41,9 +43,11 @@ class CParticleDatabase {
   static void AddToRendererClippedParticleGenMap(const DrawMap& map, const zeus::CFrustum& frustum);
   static void AddToRendererClippedParticleGenMapMasked(const DrawMap& map, const zeus::CFrustum& frustum, int mask,
                                                        int target);
-  static void UpdateParticleGenDB(float dt, const CPoseAsTransforms& pose, const CCharLayoutInfo& charInfo,
-                                  const zeus::CTransform& xf, const zeus::CVector3f& vec, CStateManager& stateMgr,
-                                  DrawMap& map, bool deleteIfDone);
+  static void PrepareParticleGenDB(const CPoseAsTransforms& pose, const CCharLayoutInfo& charInfo,
+                                   const zeus::CTransform& xf, const zeus::CVector3f& vec, CStateManager& stateMgr,
+                                   DrawMap& map, std::vector<DrawMap::iterator>& toUpdate);
+  static void FinishParticleGenDB(float dt, CStateManager& stateMgr, DrawMap& map,
+                                  std::span<const DrawMap::iterator> updated, bool deleteIfDone);
 
 public:
   CParticleDatabase();
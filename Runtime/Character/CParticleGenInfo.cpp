@@ -54,7 +54,10 @@ void CParticleGenInfoGeneric::Render() { x84_system->Render(); }
 
 void CParticleGenInfoGeneric::Update(float dt, CStateManager& stateMgr) {
   x84_system->Update(dt);
+  UpdateLight(stateMgr);
+}
 
+void CParticleGenInfoGeneric::UpdateLight(CStateManager& stateMgr) {
   if (x88_lightId == kInvalidUniqueId) {
     return;
   }
@@ -39,6 +39,9 @@ public:
   virtual void AddToRenderer() = 0;
   virtual void Render() = 0;
   virtual void Update(float dt, CStateManager& stateMgr) = 0;
+  /* Split halves of Update, so callers can batch the system updates */
+  virtual CParticleGen& GetSystem() const = 0;
+  virtual void UpdateLight(CStateManager& stateMgr) = 0;
   virtual void SetOrientation(const zeus::CTransform& xf, CStateManager& stateMgr) = 0;
   virtual void SetTranslation(const zeus::CVector3f& trans, CStateManager& stateMgr) = 0;
   virtual void SetGlobalOrientation(const zeus::CTransform& xf, CStateManager& stateMgr) = 0;
@@ -92,6 +95,8 @@ public:
   void AddToRenderer() override;
   void Render() override;
   void Update(float dt, CStateManager& stateMgr) override;
+  CParticleGen& GetSystem() const override { return *x84_system; }
+  void UpdateLight(CStateManager& stateMgr) override;
   void SetOrientation(const zeus::CTransform& xf, CStateManager& stateMgr) override;
   void SetTranslation(const zeus::CVector3f& trans, CStateManager& stateMgr) override;
   void SetGlobalOrientation(const zeus::CTransform& xf, CStateManager& stateMgr) override;
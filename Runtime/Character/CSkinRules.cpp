@@ -1,10 +1,18 @@
 #include "Runtime/Character/CSkinRules.hpp"
 
+#include "Runtime/CJobPool.hpp"
 #include "Runtime/CToken.hpp"
 #include "Runtime/Character/CPoseAsTransforms.hpp"
 #include "Runtime/Graphics/CModel.hpp"
 
+#include <optick.h>
+
 namespace metaforce {
+namespace {
+/* Smaller meshes finish faster inline than it takes to wake the job pool */
+constexpr u32 kMinParallelSkinVertices = 4096;
+constexpr size_t kMinBonesPerJob = 8;
+} // Anonymous namespace
 
 static u32 ReadCount(CInputStream& in) {
   s32 result = in.ReadLong();
@@ -24,13 +32,35 @@ static u32 ReadCount(CInputStream& in) {
 CSkinRules::CSkinRules(CInputStream& in) {
   u32 weightCount = in.ReadLong();
   x0_bones.reserve(weightCount);
+  m_boneStarts.reserve(weightCount + 1);
+  u32 start = 0;
   for (int i = 0; i < weightCount; ++i) {
-    x0_bones.emplace_back(in);
+    m_boneStarts.push_back(start);
+    start += x0_bones.emplace_back(in).GetVertexCount();
   }
+  m_boneStarts.push_back(start);
   x10_vertexCount = ReadCount(in);
   x14_normalCount = ReadCount(in);
 }
 
+/* Calls func(bone, firstVertex) for every virtual bone. Bones write disjoint output ranges,
+ * so large meshes are split across the job pool. */
+template <typename Func>
+void CSkinRules::ForEachBone(const Func& func) const {
+  if (m_boneStarts.back() < kMinParallelSkinVertices) {
+    for (size_t b = 0; b < x0_bones.size(); ++b) {
+      func(x0_bones[b], m_boneStarts[b]);
+    }
+    return;
+  }
+  CJobPool::Shared().ParallelFor(x0_bones.size(), kMinBonesPerJob, [&](size_t begin, size_t end) {
+    OPTICK_EVENT("CSkinRules::ForEachBone job");
+    for (size_t b = begin; b < end; ++b) {
+      func(x0_bones[b], m_boneStarts[b]);
+    }
+  });
+}
+
 void CSkinRules::BuildAccumulatedTransforms(const CPoseAsTransforms& pose, const CCharLayoutInfo& info) {
   std::array<zeus::CVector3f, 100> points;
   CSegId segId = pose.GetLastInserted();
@@ -48,22 +78,28 @@ void CSkinRules::BuildAccumulatedTransforms(const CPoseAsTransforms& pose, const
   }
 }
 
-void CSkinRules::BuildPoints(TConstVectorRef positions, TVectorRef out) {
-  size_t offset = 0;
-  for (auto& bone : x0_bones) {
-    u32 vertexCount = bone.GetVertexCount();
-    bone.BuildPoints(positions->data() + offset, out, vertexCount);
-    offset += vertexCount;
-  }
+void CSkinRules::BuildPoints(TConstVectorRef positions, TVectorRef out) const {
+  out->resize(m_boneStarts.back());
+  ForEachBone([&](const CVirtualBone& bone, u32 start) {
+    bone.BuildPoints(positions->data() + start, out->data() + start, bone.GetVertexCount());
+  });
 }
 
-void CSkinRules::BuildNormals(TConstVectorRef normals, TVectorRef out) {
-  size_t offset = 0;
-  for (auto& bone : x0_bones) {
-    u32 vertexCount = bone.GetVertexCount();
-    bone.BuildNormals(normals->data() + offset, out, vertexCount);
-    offset += vertexCount;
-  }
+void CSkinRules::BuildNormals(TConstVectorRef normals, TVectorRef out) const {
+  out->resize(m_boneStarts.back());
+  ForEachBone([&](const CVirtualBone& bone, u32 start) {
+    bone.BuildNormals(normals->data() + start, out->data() + start, bone.GetVertexCount());
+  });
+}
+
+void CSkinRules::BuildPointsAndNormals(TConstVectorRef positions, TConstVectorRef normals, TVectorRef pointsOut,
+                                       TVectorRef normalsOut) const {
+  pointsOut->resize(m_boneStarts.back());
+  normalsOut->resize(m_boneStarts.back());
+  ForEachBone([&](const CVirtualBone& bone, u32 start) {
+    bone.BuildPointsAndNormals(positions->data() + start, normals->data() + start, pointsOut->data() + start,
+                               normalsOut->data() + start, bone.GetVertexCount());
+  });
 }
 
 CFactoryFnReturn FSkinRulesFactory(const SObjectTag& tag, CInputStream& in, const CVParamTransfer& params,
@@ -85,15 +121,43 @@ static inline auto StreamInSkinWeighting(CInputStream& in) {
 
 CVirtualBone::CVirtualBone(CInputStream& in) : x0_weights(StreamInSkinWeighting(in)), x1c_vertexCount(in.ReadLong()) {}
 
-void CVirtualBone::BuildPoints(const zeus::CVector3f* in, TVectorRef out, u32 count) const {
+/* The bone's columns are hoisted out of the loops, so each vertex is three multiply-adds on
+ * zeus' SIMD vectors with no per-vertex matrix loads */
+void CVirtualBone::BuildPoints(const zeus::CVector3f* in, zeus::CVector3f* out, u32 count) const {
+  const zeus::CVector3f c0 = x20_xf.basis[0];
+  const zeus::CVector3f c1 = x20_xf.basis[1];
+  const zeus::CVector3f c2 = x20_xf.basis[2];
+  const zeus::CVector3f origin = x20_xf.origin;
+  for (u32 i = 0; i < count; ++i) {
+    const zeus::CVector3f& v = in[i];
+    out[i] = c0 * v.x() + c1 * v.y() + c2 * v.z() + origin;
+  }
+}
+
+void CVirtualBone::BuildNormals(const zeus::CVector3f* in, zeus::CVector3f* out, u32 count) const {
+  const zeus::CVector3f r0 = x50_rotation[0];
+  const zeus::CVector3f r1 = x50_rotation[1];
+  const zeus::CVector3f r2 = x50_rotation[2];
   for (u32 i = 0; i < count; ++i) {
-    out->emplace_back(x20_xf * in[i]);
+    const zeus::CVector3f& n = in[i];
+    out[i] = r0 * n.x() + r1 * n.y() + r2 * n.z();
   }
 }
 
-void CVirtualBone::BuildNormals(const zeus::CVector3f* in, TVectorRef out, u32 count) const {
+void CVirtualBone::BuildPointsAndNormals(const zeus::CVector3f* pointsIn, const zeus::CVector3f* normalsIn,
+                                         zeus::CVector3f* pointsOut, zeus::CVector3f* normalsOut, u32 count) const {
+  const zeus::CVector3f c0 = x20_xf.basis[0];
+  const zeus::CVector3f c1 = x20_xf.basis[1];
+  const zeus::CVector3f c2 = x20_xf.basis[2];
+  const zeus::CVector3f origin = x20_xf.origin;
+  const zeus::CVector3f r0 = x50_rotation[0];
+  const zeus::CVector3f r1 = x50_rotation[1];
+  const zeus::CVector3f r2 = x50_rotation[2];
   for (u32 i = 0; i < count; ++i) {
-    out->emplace_back(x50_rotation * in[i]);
+    const zeus::CVector3f& v = pointsIn[i];
+    const zeus::CVector3f& n = normalsIn[i];
+    pointsOut[i] = c0 * v.x() + c1 * v.y() + c2 * v.z() + origin;
+    normalsOut[i] = r0 * n.x() + r1 * n.y() + r2 * n.z();
   }
 }
 
@@ -31,8 +31,10 @@ class CVirtualBone {
 public:
   explicit CVirtualBone(CInputStream& in);
 
-  void BuildPoints(const zeus::CVector3f* in, TVectorRef out, u32 count) const;
-  void BuildNormals(const zeus::CVector3f* in, TVectorRef out, u32 count) const;
+  void BuildPoints(const zeus::CVector3f* in, zeus::CVector3f* out, u32 count) const;
+  void BuildNormals(const zeus::CVector3f* in, zeus::CVector3f* out, u32 count) const;
+  void BuildPointsAndNormals(const zeus::CVector3f* pointsIn, const zeus::CVector3f* normalsIn,
+                             zeus::CVector3f* pointsOut, zeus::CVector3f* normalsOut, u32 count) const;
   void BuildAccumulatedTransform(const CPoseAsTransforms& pose, const zeus::CVector3f* points);
 
   [[nodiscard]] const auto& GetWeights() const { return x0_weights; }
@@ -48,12 +50,21 @@ class CSkinRules {
   std::vector<CVirtualBone> x0_bones;
   u32 x10_vertexCount = 0;
   u32 x14_normalCount = 0;
+  /* First skinned vertex of each virtual bone, followed by the total */
+  std::vector<u32> m_boneStarts;
+
+  template <typename Func>
+  void ForEachBone(const Func& func) const;
 
 public:
   explicit CSkinRules(CInputStream& in);
 
-  void BuildPoints(TConstVectorRef positions, TVectorRef out);
-  void BuildNormals(TConstVectorRef normals, TVectorRef out);
+  /* Outputs are resized to the skinned vertex count and written in place */
+  void BuildPoints(TConstVectorRef positions, TVectorRef out) const;
+  void BuildNormals(TConstVectorRef normals, TVectorRef out) const;
+  /* Skins positions and normals in a single pass over the virtual bones */
+  void BuildPointsAndNormals(TConstVectorRef positions, TConstVectorRef normals, TVectorRef pointsOut,
+                             TVectorRef normalsOut) const;
   void BuildAccumulatedTransforms(const CPoseAsTransforms& pose, const CCharLayoutInfo& info);
 
   [[nodiscard]] u32 GetVertexCount() const { return x10_vertexCount; }
@@ -2,16 +2,20 @@
 
 #include "Runtime/CBasics.hpp"
 #include "Runtime/Collision/CMaterialFilter.hpp"
-#include "Runtime/Streams/IOStreams.hpp"
+#include "Runtime/Streams/CMemoryReader.hpp"
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <utility>
 
+#include <logvisor/logvisor.hpp>
 #include <zeus/CVector2i.hpp>
 
 namespace metaforce {
+static logvisor::Module Log("CAreaOctTree");
 
 static bool _close_enough(float f1, float f2, float epsilon) { return std::fabs(f1 - f2) <= epsilon; }
 
@@ -100,7 +104,7 @@ bool CAreaOctTree::Node::LineTestInternal(const zeus::CLine& line, const CMateri
       return true;
   }
 
-  if (x20_nodeType == ETreeType::Leaf) {
+  if (GetTreeType() == ETreeType::Leaf) {
     TriListReference triList = GetTriangleArray();
     for (u16 i = 0; i < triList.GetSize(); ++i) {
       CCollisionSurface triangle = x1c_owner.GetMasterListTriangle(triList.GetAt(i));
@@ -148,7 +152,7 @@ bool CAreaOctTree::Node::LineTestInternal(const zeus::CLine& line, const CMateri
       if (filter.Passes(matList))
         return false;
     }
-  } else if (x20_nodeType == ETreeType::Branch) {
+  } else if (GetTreeType() == ETreeType::Branch) {
     if (GetChildFlags() == 0xA) // 2 leaves
     {
       for (int i = 0; i < 2; ++i) {
@@ -162,7 +166,7 @@ bool CAreaOctTree::Node::LineTestInternal(const zeus::CLine& line, const CMateri
       return true;
     }
 
-    zeus::CVector3f center = x0_aabb.center();
+    zeus::CVector3f center = GetBoundingBox().center();
 
     zeus::CVector3f r6 = line.origin + lT * line.dir;
     zeus::CVector3f r7 = line.origin + hT * line.dir;
@@ -187,7 +191,7 @@ bool CAreaOctTree::Node::LineTestInternal(const zeus::CLine& line, const CMateri
       float f22 = (i < idx.first) ? r9[idx.second[i]] : hT;
       if (f22 > lowT && f21 <= f22) {
         Node child = GetChild(r26b);
-        if (child.x20_nodeType != ETreeType::Invalid)
+        if (child.GetTreeType() != ETreeType::Invalid)
           if (!child.LineTestInternal(line, filter, f21, f22, maxT, vec))
             return false;
       }
@@ -213,7 +217,7 @@ void CAreaOctTree::Node::LineTestExInternal(const zeus::CLine& line, const CMate
       return;
   }
 
-  if (x20_nodeType == ETreeType::Leaf) {
+  if (GetTreeType() == ETreeType::Leaf) {
     TriListReference triList = GetTriangleArray();
     float bestT = highT;
     bool foundTriangle = false;
@@ -274,7 +278,7 @@ void CAreaOctTree::Node::LineTestExInternal(const zeus::CLine& line, const CMate
       res = tmpRes;
       res.x0_plane = res.x10_surface->GetPlane();
     }
-  } else if (x20_nodeType == ETreeType::Branch) {
+  } else if (GetTreeType() == ETreeType::Branch) {
     if (GetChildFlags() == 0xA) // 2 leaves
     {
       std::array<SRayResult, 2> tmpRes;
@@ -305,7 +309,7 @@ void CAreaOctTree::Node::LineTestExInternal(const zeus::CLine& line, const CMate
       return;
     }
 
-    zeus::CVector3f center = x0_aabb.center(); // r26
+    zeus::CVector3f center = GetBoundingBox().center(); // r26
 
     zeus::CVector3f lowPoint = line.origin + lT * line.dir;
     zeus::CVector3f highPoint = line.origin + hT * line.dir;
@@ -386,7 +390,7 @@ void CAreaOctTree::Node::LineTestExInternal(const zeus::CLine& line, const CMate
       float tmpHiT = (i < numComps - 1) ? compT[comps[i + 1]] : hT;
       if (tmpHiT > lowT && tmpLoT <= tmpHiT) {
         Node child = GetChild(selector);
-        if (child.x20_nodeType != ETreeType::Invalid)
+        if (child.GetTreeType() != ETreeType::Invalid)
           child.LineTestExInternal(line, filter, res, tmpLoT, tmpHiT, maxT, dirRecip);
         if (res.x10_surface) {
           if (res.x3c_t > highT)
@@ -400,12 +404,12 @@ void CAreaOctTree::Node::LineTestExInternal(const zeus::CLine& line, const CMate
 }
 
 bool CAreaOctTree::Node::LineTest(const zeus::CLine& line, const CMaterialFilter& filter, float length) const {
-  if (x20_nodeType == ETreeType::Invalid)
+  if (GetTreeType() == ETreeType::Invalid)
     return true;
 
   float f1 = 0.f;
   float f2 = 0.f;
-  if (!BoxLineTest(x0_aabb, line, f1, f2))
+  if (!BoxLineTest(GetBoundingBox(), line, f1, f2))
     return true;
 
   zeus::CVector3f recip = 1.f / line.dir;
@@ -414,210 +418,276 @@ bool CAreaOctTree::Node::LineTest(const zeus::CLine& line, const CMaterialFilter
 
 void CAreaOctTree::Node::LineTestEx(const zeus::CLine& line, const CMaterialFilter& filter, SRayResult& res,
                                     float length) const {
-  if (x20_nodeType == ETreeType::Invalid)
+  if (GetTreeType() == ETreeType::Invalid)
     return;
 
   float lT = 0.f;
   float hT = 0.f;
-  if (!BoxLineTest(x0_aabb, line, lT, hT))
+  if (!BoxLineTest(GetBoundingBox(), line, lT, hT))
     return;
 
   zeus::CVector3f recip = 1.f / line.dir;
   LineTestExInternal(line, filter, res, lT - 0.000099999997f, hT + 0.000099999997f, length, recip);
 }
 
-CAreaOctTree::Node CAreaOctTree::Node::GetChild(int idx) const {
-  u16 flags = *reinterpret_cast<const u16*>(x18_ptr);
-  const u32* offsets = reinterpret_cast<const u32*>(x18_ptr + 4);
-  ETreeType type = ETreeType((flags >> (2 * idx)) & 0x3);
-
-  if (type == ETreeType::Branch) {
-    zeus::CAABox pos, neg, res;
-    x0_aabb.splitZ(neg, pos);
-    if (idx & 4) {
-      zeus::CAABox(pos).splitY(neg, pos);
-      if (idx & 2) {
-        zeus::CAABox(pos).splitX(neg, pos);
-        if (idx & 1)
-          res = pos;
-        else
-          res = neg;
-      } else {
-        zeus::CAABox(neg).splitX(neg, pos);
-        if (idx & 1)
-          res = pos;
-        else
-          res = neg;
-      }
-    } else {
-      zeus::CAABox(neg).splitY(neg, pos);
-      if (idx & 2) {
-        zeus::CAABox(pos).splitX(neg, pos);
-        if (idx & 1)
-          res = pos;
-        else
-          res = neg;
-      } else {
-        zeus::CAABox(neg).splitX(neg, pos);
-        if (idx & 1)
-          res = pos;
-        else
-          res = neg;
-      }
+void CAreaOctTree::SRayPacket::AddRay(const zeus::CVector3f& origin, const zeus::CVector3f& dir, float length,
+                                      const CMaterialFilter& filter) {
+  /* Axis-parallel rays get a huge finite reciprocal so slab products never become 0 * inf */
+  const auto recip = [](float d) { return std::fabs(d) > FLT_MIN ? 1.f / d : std::copysign(1e30f, d); };
+  const u32 i = count++;
+  ox[i] = origin.x();
+  oy[i] = origin.y();
+  oz[i] = origin.z();
+  dx[i] = dir.x();
+  dy[i] = dir.y();
+  dz[i] = dir.z();
+  rx[i] = recip(dx[i]);
+  ry[i] = recip(dy[i]);
+  rz[i] = recip(dz[i]);
+  maxT[i] = length > 0.f ? length : 100000.f;
+  filters[i] = &filter;
+  results[i] = SRayResult();
+}
+
+void CAreaOctTree::PacketTestLeaf(const SNativeNode& node, SRayPacket& packet, u32 mask) const {
+  const u16* triList = &m_leafTris[node.data];
+  std::array<float, SRayPacket::kRaysPerPacket> laneT;
+
+  for (u32 t = 1; t <= triList[0]; ++t) {
+    const u16 triIdx = triList[t];
+    const std::array<u16, 3>& tri = m_triVerts[triIdx];
+    const zeus::CVector3f& v0 = m_verts[tri[0]];
+    const zeus::CVector3f e0 = m_verts[tri[1]] - v0;
+    const zeus::CVector3f e1 = m_verts[tri[2]] - v0;
+    const float v0x = v0.x(), v0y = v0.y(), v0z = v0.z();
+    const float e0x = e0.x(), e0y = e0.y(), e0z = e0.z();
+    const float e1x = e1.x(), e1y = e1.y(), e1z = e1.z();
+
+    /* Möller–Trumbore over every lane, same tolerances as LineTestExInternal */
+    u32 hitMask = 0;
+    for (u32 i = 0; i < packet.count; ++i) {
+      const float px = packet.dy[i] * e1z - packet.dz[i] * e1y;
+      const float py = packet.dz[i] * e1x - packet.dx[i] * e1z;
+      const float pz = packet.dx[i] * e1y - packet.dy[i] * e1x;
+      const float det = px * e0x + py * e0y + pz * e0z;
+      const float invDet = 1.f / det;
+      const float tx = packet.ox[i] - v0x;
+      const float ty = packet.oy[i] - v0y;
+      const float tz = packet.oz[i] - v0z;
+      const float u = invDet * (tx * px + ty * py + tz * pz);
+      const float qx = ty * e0z - tz * e0y;
+      const float qy = tz * e0x - tx * e0z;
+      const float qz = tx * e0y - ty * e0x;
+      const float v = invDet * (qx * packet.dx[i] + qy * packet.dy[i] + qz * packet.dz[i]);
+      laneT[i] = invDet * (qx * e1x + qy * e1y + qz * e1z);
+      const bool hit = (std::fabs(det) >= FLT_EPSILON * 10.f) & (u >= 0.f) & (u <= 1.f) & (v >= 0.f) &
+                       (u + v <= 1.f) & (laneT[i] >= 0.f) & (laneT[i] < packet.maxT[i]);
+      hitMask |= u32(hit) << i;
     }
 
-    return Node(x18_ptr + offsets[idx] + 36, res, x1c_owner, ETreeType::Branch);
-  } else if (type == ETreeType::Leaf) {
-    const float* aabb = reinterpret_cast<const float*>(x18_ptr + offsets[idx] + 36);
-    zeus::CAABox aabbObj(aabb[0], aabb[1], aabb[2], aabb[3], aabb[4], aabb[5]);
-    return Node(aabb, aabbObj, x1c_owner, ETreeType::Leaf);
-  } else {
-    return Node(nullptr, zeus::skNullBox, x1c_owner, ETreeType::Invalid);
+    hitMask &= mask;
+    if (hitMask == 0) {
+      continue;
+    }
+    const CMaterialList matList(GetTriangleMaterial(triIdx));
+    for (; hitMask != 0; hitMask &= hitMask - 1) {
+      const int i = std::countr_zero(hitMask);
+      if (!packet.filters[i]->Passes(matList)) {
+        continue;
+      }
+      SRayResult& res = packet.results[i];
+      res.x10_surface.emplace(GetMasterListTriangle(triIdx));
+      res.x0_plane = res.x10_surface->GetPlane();
+      res.x3c_t = laneT[i];
+      packet.maxT[i] = laneT[i];
+    }
   }
 }
 
-void CAreaOctTree::SwapTreeNode(u8* ptr, Node::ETreeType type) {
-  if (type == Node::ETreeType::Branch) {
-    u16* typeBits = reinterpret_cast<u16*>(ptr);
-    *typeBits = CBasics::SwapBytes(*typeBits);
-    u32* offsets = reinterpret_cast<u32*>(ptr + 4);
+void CAreaOctTree::PacketTestNode(const SNativeNode& node, SRayPacket& packet, u32 mask) const {
+  const float minX = node.aabb.min.x(), minY = node.aabb.min.y(), minZ = node.aabb.min.z();
+  const float maxX = node.aabb.max.x(), maxY = node.aabb.max.y(), maxZ = node.aabb.max.z();
+  u32 hitMask = 0;
+  for (u32 i = 0; i < packet.count; ++i) {
+    const float tx0 = (minX - packet.ox[i]) * packet.rx[i];
+    const float tx1 = (maxX - packet.ox[i]) * packet.rx[i];
+    const float ty0 = (minY - packet.oy[i]) * packet.ry[i];
+    const float ty1 = (maxY - packet.oy[i]) * packet.ry[i];
+    const float tz0 = (minZ - packet.oz[i]) * packet.rz[i];
+    const float tz1 = (maxZ - packet.oz[i]) * packet.rz[i];
+    const float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), 0.f));
+    const float tFar =
+        std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), packet.maxT[i]));
+    hitMask |= u32(tNear <= tFar + 0.000099999997f) << i;
+  }
+
+  mask &= hitMask;
+  if (mask == 0) {
+    return;
+  }
+  if (Node::ETreeType(node.type) == Node::ETreeType::Leaf) {
+    PacketTestLeaf(node, packet, mask);
+    return;
+  }
 
-    for (int i = 0; i < 8; ++i) {
-      Node::ETreeType ctype = Node::ETreeType((*typeBits >> (2 * i)) & 0x3);
-      offsets[i] = CBasics::SwapBytes(offsets[i]);
-      SwapTreeNode(ptr + offsets[i] + 36, ctype);
+  /* Visit children nearest-first for the leading ray so later children are culled by the shrunken maxT */
+  const int lead = std::countr_zero(mask);
+  const int order = (packet.dx[lead] < 0.f ? 1 : 0) | (packet.dy[lead] < 0.f ? 2 : 0) | (packet.dz[lead] < 0.f ? 4 : 0);
+  for (int i = 0; i < 8; ++i) {
+    const u32 bit = 1u << (i ^ order);
+    if ((node.validChildren & bit) == 0) {
+      continue;
     }
-  } else if (type == Node::ETreeType::Leaf) {
-    float* aabb = reinterpret_cast<float*>(ptr);
-    aabb[0] = CBasics::SwapBytes(aabb[0]);
-    aabb[1] = CBasics::SwapBytes(aabb[1]);
-    aabb[2] = CBasics::SwapBytes(aabb[2]);
-    aabb[3] = CBasics::SwapBytes(aabb[3]);
-    aabb[4] = CBasics::SwapBytes(aabb[4]);
-    aabb[5] = CBasics::SwapBytes(aabb[5]);
-
-    u16* countIdxs = reinterpret_cast<u16*>(ptr + 24);
-    *countIdxs = CBasics::SwapBytes(*countIdxs);
-    for (u16 i = 0; i < *countIdxs; ++i)
-      countIdxs[i + 1] = CBasics::SwapBytes(countIdxs[i + 1]);
+    const u32 rank = u32(std::popcount(u32(node.validChildren) & (bit - 1)));
+    PacketTestNode(m_nodes[node.data + rank], packet, mask);
   }
 }
 
-CAreaOctTree::CAreaOctTree(const zeus::CAABox& aabb, Node::ETreeType treeType, const u8* buf, const u8* treeBuf,
-                           u32 matCount, const u32* materials, const u8* vertMats, const u8* edgeMats,
-                           const u8* polyMats, u32 edgeCount, const CCollisionEdge* edges, u32 polyCount,
-                           const u16* polyEdges, u32 vertCount, const float* verts)
-: x0_aabb(aabb)
-, x18_treeType(treeType)
-, x1c_buf(buf)
-, x20_treeBuf(treeBuf)
-, x24_matCount(matCount)
-, x28_materials(materials)
-, x2c_vertMats(vertMats)
-, x30_edgeMats(edgeMats)
-, x34_polyMats(polyMats)
-, x38_edgeCount(edgeCount)
-, x3c_edges(edges)
-, x40_polyCount(polyCount)
-, x44_polyEdges(polyEdges)
-, x48_vertCount(vertCount)
-, x4c_verts(verts) {
-  SwapTreeNode(const_cast<u8*>(x20_treeBuf), treeType);
-
-  for (u32 i = 0; i < matCount; ++i)
-    const_cast<u32*>(x28_materials)[i] = CBasics::SwapBytes(x28_materials[i]);
-
-  for (u32 i = 0; i < edgeCount; ++i)
-    const_cast<CCollisionEdge*>(x3c_edges)[i].swapBig();
-
-  for (u32 i = 0; i < polyCount; ++i)
-    const_cast<u16*>(x44_polyEdges)[i] = CBasics::SwapBytes(x44_polyEdges[i]);
-
-  for (u32 i = 0; i < vertCount * 3; ++i)
-    const_cast<float*>(x4c_verts)[i] = CBasics::SwapBytes(x4c_verts[i]);
+void CAreaOctTree::LineTestExPacket(SRayPacket& packet) const {
+  if (m_nodes.empty() || packet.count == 0) {
+    return;
+  }
+  PacketTestNode(m_nodes.front(), packet, (1u << packet.count) - 1);
+}
+
+CAreaOctTree::Node CAreaOctTree::Node::GetChild(int idx) const {
+  const u32 bit = 1u << idx;
+  if ((x0_node->validChildren & bit) == 0) {
+    return Node(nullptr, x1c_owner);
+  }
+  const u32 rank = u32(std::popcount(u32(x0_node->validChildren) & (bit - 1)));
+  return Node(&x1c_owner.m_nodes[x0_node->data + rank], x1c_owner);
+}
+
+static zeus::CAABox GetBranchChildBox(const zeus::CAABox& aabb, int idx) {
+  zeus::CAABox pos, neg;
+  aabb.splitZ(neg, pos);
+  zeus::CAABox(idx & 4 ? pos : neg).splitY(neg, pos);
+  zeus::CAABox(idx & 2 ? pos : neg).splitX(neg, pos);
+  return idx & 1 ? pos : neg;
+}
+
+void CAreaOctTree::ConvertNode(u32 nodeIdx, const u8* ptr, Node::ETreeType type, const zeus::CAABox& aabb) {
+  m_nodes[nodeIdx].aabb = aabb;
+  m_nodes[nodeIdx].type = u8(type);
+
+  if (type == Node::ETreeType::Leaf) {
+    const u16* triList = reinterpret_cast<const u16*>(ptr + 24);
+    const u16 count = CBasics::SwapBytes(triList[0]);
+    m_nodes[nodeIdx].data = u32(m_leafTris.size());
+    for (u16 i = 0; i <= count; ++i) {
+      m_leafTris.push_back(CBasics::SwapBytes(triList[i]));
+    }
+    return;
+  }
+
+  const u16 flags = CBasics::SwapBytes(*reinterpret_cast<const u16*>(ptr));
+  const u32* offsets = reinterpret_cast<const u32*>(ptr + 4);
+  u8 validChildren = 0;
+  for (int i = 0; i < 8; ++i) {
+    const auto ctype = Node::ETreeType((flags >> (2 * i)) & 0x3);
+    if (ctype == Node::ETreeType::Branch || ctype == Node::ETreeType::Leaf) {
+      validChildren |= 1 << i;
+    }
+  }
+  const u32 firstChild = u32(m_nodes.size());
+  m_nodes[nodeIdx].data = firstChild;
+  m_nodes[nodeIdx].childFlags = flags;
+  m_nodes[nodeIdx].validChildren = validChildren;
+  m_nodes.resize(firstChild + std::popcount(u32(validChildren)));
+
+  u32 childIdx = firstChild;
+  for (int i = 0; i < 8; ++i) {
+    if ((validChildren & (1 << i)) == 0) {
+      continue;
+    }
+    const auto ctype = Node::ETreeType((flags >> (2 * i)) & 0x3);
+    const u8* childPtr = ptr + CBasics::SwapBytes(offsets[i]) + 36;
+    if (ctype == Node::ETreeType::Branch) {
+      ConvertNode(childIdx, childPtr, ctype, GetBranchChildBox(aabb, i));
+    } else {
+      const float* box = reinterpret_cast<const float*>(childPtr);
+      ConvertNode(childIdx, childPtr, ctype,
+                  zeus::CAABox(CBasics::SwapBytes(box[0]), CBasics::SwapBytes(box[1]), CBasics::SwapBytes(box[2]),
+                               CBasics::SwapBytes(box[3]), CBasics::SwapBytes(box[4]), CBasics::SwapBytes(box[5])));
+    }
+    ++childIdx;
+  }
 }
 
 std::unique_ptr<CAreaOctTree> CAreaOctTree::MakeFromMemory(const u8* buf, unsigned int size) {
-  CMemoryInStream r(buf + 8, size - 8, CMemoryInStream::EOwnerShip::NotOwned);
-  r.ReadLong();
-  r.ReadLong();
-  zeus::CAABox aabb = r.Get<zeus::CAABox>();
+  CMemoryReader r(buf, size);
+  r.Skip(16);
+  zeus::CAABox aabb = r.ReadAABox();
   Node::ETreeType nodeType = Node::ETreeType(r.ReadLong());
   u32 treeSize = r.ReadLong();
-  const u8* cur = reinterpret_cast<const u8*>(buf) + 8 + r.GetReadPosition();
-
-  const u8* treeBuf = cur;
-  cur += treeSize;
-
-  u32 matCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const u32* matBuf = reinterpret_cast<const u32*>(cur);
-  cur += 4 * matCount;
-
-  u32 vertMatsCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const u8* vertMatsBuf = cur;
-  cur += vertMatsCount;
-
-  u32 edgeMatsCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const u8* edgeMatsBuf = cur;
-  cur += edgeMatsCount;
-
-  u32 polyMatsCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const u8* polyMatsBuf = cur;
-  cur += polyMatsCount;
-
-  u32 edgeCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const CCollisionEdge* edgeBuf = reinterpret_cast<const CCollisionEdge*>(cur);
-  cur += edgeCount * sizeof(edgeCount);
-
-  u32 polyCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const u16* polyBuf = reinterpret_cast<const u16*>(cur);
-  cur += polyCount * 2;
-
-  u32 vertCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>(cur));
-  cur += 4;
-  const float* vertBuf = reinterpret_cast<const float*>(cur);
-
-  return std::make_unique<CAreaOctTree>(aabb, nodeType, reinterpret_cast<const u8*>(buf + 8), treeBuf, matCount, matBuf,
-                                        vertMatsBuf, edgeMatsBuf, polyMatsBuf, edgeCount, edgeBuf, polyCount, polyBuf,
-                                        vertCount, vertBuf);
+  const u8* treeBuf = r.GetCurrentPtr();
+  r.Skip(treeSize);
+
+  auto ret = std::make_unique<CAreaOctTree>(aabb);
+  if (nodeType == Node::ETreeType::Branch || nodeType == Node::ETreeType::Leaf) {
+    ret->m_nodes.resize(1);
+    ret->ConvertNode(0, treeBuf, nodeType, aabb);
+  }
+
+  ret->m_materials.resize(r.ReadUint32());
+  r.ReadArray<u32>(ret->m_materials);
+  ret->m_vertMats.resize(r.ReadUint32());
+  r.ReadArray<u8>(ret->m_vertMats);
+  ret->m_edgeMats.resize(r.ReadUint32());
+  r.ReadArray<u8>(ret->m_edgeMats);
+  ret->m_polyMats.resize(r.ReadUint32());
+  r.ReadArray<u8>(ret->m_polyMats);
+
+  std::vector<u16> edgeVerts(size_t(r.ReadUint32()) * 2);
+  r.ReadArray<u16>(edgeVerts);
+  ret->m_edges.reserve(edgeVerts.size() / 2);
+  for (size_t i = 0; i < edgeVerts.size(); i += 2) {
+    ret->m_edges.emplace_back(edgeVerts[i], edgeVerts[i + 1]);
+  }
+  ret->m_polyEdges.resize(r.ReadUint32());
+  r.ReadArray<u16>(ret->m_polyEdges);
+
+  std::vector<float> vertComps(size_t(r.ReadUint32()) * 3);
+  r.ReadArray<float>(vertComps);
+  ret->m_verts.reserve(vertComps.size() / 3);
+  for (size_t i = 0; i < vertComps.size(); i += 3) {
+    ret->m_verts.emplace_back(vertComps[i], vertComps[i + 1], vertComps[i + 2]);
+  }
+  if (r.HasOverrun()) {
+    Log.report(logvisor::Fatal, FMT_STRING("Collision section is truncated ({} bytes)"), size);
+  }
+
+  /* Resolve each triangle's vertices once instead of walking its edges on every query */
+  ret->m_triVerts.resize(ret->m_polyEdges.size() / 3);
+  for (size_t i = 0; i < ret->m_triVerts.size(); ++i) {
+    const CCollisionEdge& e0 = ret->m_edges[ret->m_polyEdges[i * 3]];
+    const CCollisionEdge& e1 = ret->m_edges[ret->m_polyEdges[i * 3 + 1]];
+    std::array<u16, 3>& tri = ret->m_triVerts[i];
+    tri[2] = (e1.GetVertIndex1() != e0.GetVertIndex1() && e1.GetVertIndex1() != e0.GetVertIndex2())
+                 ? e1.GetVertIndex1()
+                 : e1.GetVertIndex2();
+    if (ret->GetTriangleMaterial(int(i)) & 0x2000000) {
+      tri[0] = e0.GetVertIndex2();
+      tri[1] = e0.GetVertIndex1();
+    } else {
+      tri[0] = e0.GetVertIndex1();
+      tri[1] = e0.GetVertIndex2();
+    }
+  }
+  return ret;
 }
 
 CCollisionSurface CAreaOctTree::GetMasterListTriangle(u16 idx) const {
-  const CCollisionEdge& e0 = x3c_edges[x44_polyEdges[idx * 3]];
-  const CCollisionEdge& e1 = x3c_edges[x44_polyEdges[idx * 3 + 1]];
-  u16 vert2 = e1.GetVertIndex2();
-  if (e1.GetVertIndex1() != e0.GetVertIndex1())
-    if (e1.GetVertIndex1() != e0.GetVertIndex2())
-      vert2 = e1.GetVertIndex1();
-
-  u32 material = x28_materials[x34_polyMats[idx]];
-  if (material & 0x2000000)
-    return CCollisionSurface(GetVert(e0.GetVertIndex2()), GetVert(e0.GetVertIndex1()), GetVert(vert2), material);
-  else
-    return CCollisionSurface(GetVert(e0.GetVertIndex1()), GetVert(e0.GetVertIndex2()), GetVert(vert2), material);
+  const std::array<u16, 3>& tri = m_triVerts[idx];
+  return CCollisionSurface(m_verts[tri[0]], m_verts[tri[1]], m_verts[tri[2]], GetTriangleMaterial(idx));
 }
 
 void CAreaOctTree::GetTriangleVertexIndices(u16 idx, u16 indicesOut[3]) const {
-  const CCollisionEdge& e0 = x3c_edges[x44_polyEdges[idx * 3]];
-  const CCollisionEdge& e1 = x3c_edges[x44_polyEdges[idx * 3 + 1]];
-  indicesOut[2] = (e1.GetVertIndex1() != e0.GetVertIndex1() && e1.GetVertIndex1() != e0.GetVertIndex2())
-                      ? e1.GetVertIndex1()
-                      : e1.GetVertIndex2();
-
-  u32 material = x28_materials[x34_polyMats[idx]];
-  if (material & 0x2000000) {
-    indicesOut[0] = e0.GetVertIndex2();
-    indicesOut[1] = e0.GetVertIndex1();
-  } else {
-    indicesOut[0] = e0.GetVertIndex1();
-    indicesOut[1] = e0.GetVertIndex2();
-  }
+  const std::array<u16, 3>& tri = m_triVerts[idx];
+  indicesOut[0] = tri[0];
+  indicesOut[1] = tri[1];
+  indicesOut[2] = tri[2];
 }
 
 } // namespace metaforce
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/Collision/CCollisionEdge.hpp"
@@ -32,15 +35,39 @@ public:
     u16 GetSize() const { return m_ptr[0]; }
   };
 
+  /* Native-endian node converted once at load. Child bounds are precomputed, and the valid
+   * children of a branch are stored contiguously starting at data. */
+  struct SNativeNode {
+    zeus::CAABox aabb;
+    u32 data = 0; /* Branch: index of first child in node array, Leaf: offset of triangle list */
+    u16 childFlags = 0;
+    u8 validChildren = 0;
+    u8 type = 0;
+  };
+
+  /* Up to kRaysPerPacket rays traversed together by LineTestExPacket. Lanes are stored as
+   * separate arrays so the box and triangle tests run over every ray of the packet at once. */
+  struct SRayPacket {
+    static constexpr u32 kRaysPerPacket = 16;
+    std::array<float, kRaysPerPacket> ox, oy, oz;
+    std::array<float, kRaysPerPacket> dx, dy, dz;
+    std::array<float, kRaysPerPacket> rx, ry, rz; /* Reciprocal direction */
+    std::array<float, kRaysPerPacket> maxT;       /* Closest accepted hit so far, shrinks while traversing */
+    std::array<const CMaterialFilter*, kRaysPerPacket> filters{};
+    std::array<SRayResult, kRaysPerPacket> results;
+    u32 count = 0;
+
+    /* length <= 0 tests out to 100000 units, matching CGameCollision::RayStaticIntersection */
+    void AddRay(const zeus::CVector3f& origin, const zeus::CVector3f& dir, float length, const CMaterialFilter& filter);
+  };
+
   class Node {
   public:
     enum class ETreeType { Invalid, Branch, Leaf };
 
   private:
-    zeus::CAABox x0_aabb;
-    const u8* x18_ptr;
+    const SNativeNode* x0_node;
     const CAreaOctTree& x1c_owner;
-    ETreeType x20_nodeType;
 
     bool LineTestInternal(const zeus::CLine& line, const CMaterialFilter& filter, float lT, float hT, float maxT,
                           const zeus::CVector3f& vec) const;
@@ -48,71 +75,65 @@ public:
                             float maxT, const zeus::CVector3f& dirRecip) const;
 
   public:
-    Node(const void* ptr, const zeus::CAABox& aabb, const CAreaOctTree& owner, ETreeType type)
-    : x0_aabb(aabb), x18_ptr(reinterpret_cast<const u8*>(ptr)), x1c_owner(owner), x20_nodeType(type) {}
+    Node(const SNativeNode* node, const CAreaOctTree& owner) : x0_node(node), x1c_owner(owner) {}
 
     bool LineTest(const zeus::CLine& line, const CMaterialFilter& filter, float length) const;
     void LineTestEx(const zeus::CLine& line, const CMaterialFilter& filter, SRayResult& res, float length) const;
 
     const CAreaOctTree& GetOwner() const { return x1c_owner; }
 
-    const zeus::CAABox& GetBoundingBox() const { return x0_aabb; }
+    const zeus::CAABox& GetBoundingBox() const { return x0_node != nullptr ? x0_node->aabb : zeus::skNullBox; }
 
-    u16 GetChildFlags() const { return *reinterpret_cast<const u16*>(x18_ptr); }
+    u16 GetChildFlags() const { return x0_node->childFlags; }
 
     Node GetChild(int idx) const;
 
-    TriListReference GetTriangleArray() const { return TriListReference(reinterpret_cast<const u16*>(x18_ptr + 24)); }
+    TriListReference GetTriangleArray() const { return TriListReference(&x1c_owner.m_leafTris[x0_node->data]); }
 
-    ETreeType GetChildType(int idx) const {
-      u16 flags = *reinterpret_cast<const u16*>(x18_ptr);
-      return ETreeType((flags >> (2 * idx)) & 0x3);
-    }
+    ETreeType GetChildType(int idx) const { return ETreeType((x0_node->childFlags >> (2 * idx)) & 0x3); }
 
-    ETreeType GetTreeType() const { return x20_nodeType; }
+    ETreeType GetTreeType() const { return x0_node != nullptr ? ETreeType(x0_node->type) : ETreeType::Invalid; }
   };
 
+private:
   zeus::CAABox x0_aabb;
-  Node::ETreeType x18_treeType;
-  const u8* x1c_buf;
-  const u8* x20_treeBuf;
-  u32 x24_matCount;
-  const u32* x28_materials;
-  const u8* x2c_vertMats;
-  const u8* x30_edgeMats;
-  const u8* x34_polyMats;
-  u32 x38_edgeCount;
-  const CCollisionEdge* x3c_edges;
-  u32 x40_polyCount;
-  const u16* x44_polyEdges;
-  u32 x48_vertCount;
-  const float* x4c_verts;
-
-  void SwapTreeNode(u8* ptr, Node::ETreeType type);
+  std::vector<SNativeNode> m_nodes;
+  std::vector<u16> m_leafTris; /* Count-prefixed index lists, one per leaf */
+  std::vector<u32> m_materials;
+  std::vector<u8> m_vertMats;
+  std::vector<u8> m_edgeMats;
+  std::vector<u8> m_polyMats;
+  std::vector<CCollisionEdge> m_edges;
+  std::vector<u16> m_polyEdges;
+  std::vector<zeus::CVector3f> m_verts;
+  std::vector<std::array<u16, 3>> m_triVerts; /* Resolved from edges with winding already applied */
+
+  void ConvertNode(u32 nodeIdx, const u8* ptr, Node::ETreeType type, const zeus::CAABox& aabb);
+  void PacketTestNode(const SNativeNode& node, SRayPacket& packet, u32 mask) const;
+  void PacketTestLeaf(const SNativeNode& node, SRayPacket& packet, u32 mask) const;
 
 public:
-  CAreaOctTree(const zeus::CAABox& aabb, Node::ETreeType treeType, const u8* buf, const u8* treeBuf, u32 matCount,
-               const u32* materials, const u8* vertMats, const u8* edgeMats, const u8* polyMats, u32 edgeCount,
-               const CCollisionEdge* edges, u32 polyCount, const u16* polyEdges, u32 vertCount, const float* verts);
+  explicit CAreaOctTree(const zeus::CAABox& aabb) : x0_aabb(aabb) {}
 
   const zeus::CAABox& GetAABB() const { return x0_aabb; }
-  Node GetRootNode() const { return Node(x20_treeBuf, x0_aabb, *this, x18_treeType); }
-  const u8* GetTreeMemory() const { return x20_treeBuf; }
-  zeus::CVector3f GetVert(int idx) const {
-    const float* vert = &x4c_verts[idx * 3];
-    return zeus::CVector3f(vert[0], vert[1], vert[2]);
-  }
-  const CCollisionEdge& GetEdge(int idx) const { return x3c_edges[idx]; }
-  u32 GetVertMaterial(int idx) const { return x28_materials[x2c_vertMats[idx]]; }
-  u32 GetEdgeMaterial(int idx) const { return x28_materials[x30_edgeMats[idx]]; }
-  u32 GetTriangleMaterial(int idx) const { return x28_materials[x34_polyMats[idx]]; }
-  u32 GetNumEdges() const { return x38_edgeCount; }
-  u32 GetNumVerts() const { return x48_vertCount; }
-  u32 GetNumTriangles() const { return x40_polyCount; }
+  Node GetRootNode() const { return Node(m_nodes.empty() ? nullptr : m_nodes.data(), *this); }
+  const zeus::CVector3f& GetVert(int idx) const { return m_verts[idx]; }
+  const CCollisionEdge& GetEdge(int idx) const { return m_edges[idx]; }
+  u32 GetVertMaterial(int idx) const { return m_materials[m_vertMats[idx]]; }
+  u32 GetEdgeMaterial(int idx) const { return m_materials[m_edgeMats[idx]]; }
+  u32 GetTriangleMaterial(int idx) const { return m_materials[m_polyMats[idx]]; }
+  u32 GetNumEdges() const { return u32(m_edges.size()); }
+  u32 GetNumVerts() const { return u32(m_verts.size()); }
+  u32 GetNumTriangles() const { return u32(m_polyEdges.size()); }
   CCollisionSurface GetMasterListTriangle(u16 idx) const;
   void GetTriangleVertexIndices(u16 idx, u16 indicesOut[3]) const;
-  const u16* GetTriangleEdgeIndices(u16 idx) const { return &x44_polyEdges[idx * 3]; }
+  const u16* GetTriangleEdgeIndices(u16 idx) const { return &m_polyEdges[idx * 3]; }
+
+  /* Closest hit per ray within its maxT; rays that already hit another area keep their result
+   * unless this tree has something closer */
+  void LineTestExPacket(SRayPacket& packet) const;
 
+  /* Converts the big-endian MREA collision section; buf is only read and may be released afterwards */
   static std::unique_ptr<CAreaOctTree> MakeFromMemory(const u8* buf, unsigned int size);
 };
 
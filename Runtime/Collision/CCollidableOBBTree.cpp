@@ -102,7 +102,7 @@ bool CCollidableOBBTree::LineIntersectsOBBTree(const COBBTree::CNode& node, CRay
       if (LineIntersectsOBBTree(node.GetLeft(), node.GetRight(), info))
         ret = true;
     }
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
   } else {
     const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
   }
@@ -132,6 +132,7 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
                                                      const CMaterialFilter& filter, const zeus::CVector3f& dir,
                                                      double& dOut, CCollisionInfo& infoOut) const {
   bool ret = false;
+  CMetroidAreaCollider::SDupPrimitiveScratch& scratch = CMetroidAreaCollider::GetScratch();
 
   zeus::CAABox aabb(sphere.position - sphere.radius, sphere.position + sphere.radius);
   zeus::CAABox moveAABB = aabb;
@@ -173,8 +174,8 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
           for (int k = 0; k < 3; ++k) {
             if (intersects || outsideEdges[k]) {
               u16 edgeIdx = edgeIndices[k];
-              if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupEdgeList[edgeIdx]) {
-                CMetroidAreaCollider::g_DupEdgeList[edgeIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+              if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupEdgeList[edgeIdx]) {
+                scratch.m_dupEdgeList[edgeIdx] = scratch.m_dupPrimitiveCheckCount;
                 CMaterialList edgeMat(x10_tree->GetEdgeMaterial(edgeIdx));
                 if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
                   int nextIdx = (k + 1) % 3;
@@ -223,8 +224,8 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
           for (int k = 0; k < 3; ++k) {
             const u16 vertIdx = vertIndices[k];
             if (testVert[k]) {
-              if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupVertexList[vertIdx]) {
-                CMetroidAreaCollider::g_DupVertexList[vertIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+              if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupVertexList[vertIdx]) {
+                scratch.m_dupVertexList[vertIdx] = scratch.m_dupPrimitiveCheckCount;
                 double d = dOut;
                 if (CollisionUtil::RaySphereIntersection_Double(zeus::CSphere(surf.GetVert(k), sphere.radius),
                                                                 sphere.position, dir, d) &&
@@ -236,20 +237,20 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
                 }
               }
             } else {
-              CMetroidAreaCollider::g_DupVertexList[vertIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIdx] = scratch.m_dupPrimitiveCheckCount;
             }
           }
         }
       } else {
         const u16* edgeIndices = x10_tree->GetTriangleEdgeIndices(triIdx);
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        scratch.m_dupEdgeList[edgeIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupEdgeList[edgeIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupEdgeList[edgeIndices[2]] = scratch.m_dupPrimitiveCheckCount;
 
         const auto vertIndices = x10_tree->GetTriangleVertexIndices(triIdx);
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        scratch.m_dupVertexList[vertIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupVertexList[vertIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupVertexList[vertIndices[2]] = scratch.m_dupPrimitiveCheckCount;
       }
     }
   }
@@ -265,7 +266,7 @@ bool CCollidableOBBTree::SphereCollisionMoving(const COBBTree::CNode& node, cons
 
   const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
   if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
     if (node.IsLeaf()) {
       if (SphereCollideWithLeafMoving(node.GetLeafData(), xf, sphere, material, filter, dir, dOut, info))
         ret = true;
@@ -289,6 +290,7 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
                                                     const zeus::CVector3f& dir, double& dOut,
                                                     CCollisionInfo& infoOut) const {
   bool ret = false;
+  CMetroidAreaCollider::SDupPrimitiveScratch& scratch = CMetroidAreaCollider::GetScratch();
 
   zeus::CAABox movedAABB = components.x6e8_aabb;
   zeus::CVector3f moveVec = float(dOut) * dir;
@@ -322,8 +324,8 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
         for (int k = 0; k < 3; ++k) {
           u16 vertIdx = vertIndices[k];
           const zeus::CVector3f& vtx = surf.GetVert(k);
-          if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupVertexList[vertIdx]) {
-            CMetroidAreaCollider::g_DupVertexList[vertIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+          if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupVertexList[vertIdx]) {
+            scratch.m_dupVertexList[vertIdx] = scratch.m_dupPrimitiveCheckCount;
             if (movedAABB.pointInside(vtx)) {
               d = dOut;
               if (CMetroidAreaCollider::MovingAABoxCollisionCheck_TriVertexBox(vtx, aabb, dir, d, normal, point) &&
@@ -340,8 +342,8 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
         const u16* edgeIndices = x10_tree->GetTriangleEdgeIndices(triIdx);
         for (int k = 0; k < 3; ++k) {
           u16 edgeIdx = edgeIndices[k];
-          if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupEdgeList[edgeIdx]) {
-            CMetroidAreaCollider::g_DupEdgeList[edgeIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+          if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupEdgeList[edgeIdx]) {
+            scratch.m_dupEdgeList[edgeIdx] = scratch.m_dupPrimitiveCheckCount;
             CMaterialList edgeMat(x10_tree->GetEdgeMaterial(edgeIdx));
             if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
               d = dOut;
@@ -357,14 +359,14 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
         }
       } else {
         const u16* edgeIndices = x10_tree->GetTriangleEdgeIndices(triIdx);
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        scratch.m_dupEdgeList[edgeIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupEdgeList[edgeIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupEdgeList[edgeIndices[2]] = scratch.m_dupPrimitiveCheckCount;
 
         const auto vertIndices = x10_tree->GetTriangleVertexIndices(triIdx);
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        scratch.m_dupVertexList[vertIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupVertexList[vertIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+        scratch.m_dupVertexList[vertIndices[2]] = scratch.m_dupPrimitiveCheckCount;
       }
     }
   }
@@ -381,7 +383,7 @@ bool CCollidableOBBTree::AABoxCollisionMoving(const COBBTree::CNode& node, const
 
   const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
   if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
     if (node.IsLeaf()) {
       if (AABoxCollideWithLeafMoving(node.GetLeafData(), xf, aabb, material, filter, components, dir, dOut, info))
         ret = true;
@@ -403,7 +405,7 @@ bool CCollidableOBBTree::SphereCollisionBoolean(const COBBTree::CNode& node, con
                                                 const CMaterialFilter& filter) const {
   const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
   if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
     if (node.IsLeaf()) {
       for (u16 surfIdx : node.GetLeafData().GetSurfaceVector()) {
         CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
@@ -434,7 +436,7 @@ bool CCollidableOBBTree::AABoxCollisionBoolean(const COBBTree::CNode& node, cons
 
   const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
   if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
     if (node.IsLeaf()) {
       for (u16 surfIdx : node.GetLeafData().GetSurfaceVector()) {
         CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
@@ -489,7 +491,7 @@ bool CCollidableOBBTree::SphereCollision(const COBBTree::CNode& node, const zeus
 
   const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
   if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
     if (node.IsLeaf()) {
       if (SphereCollideWithLeaf(node.GetLeafData(), xf, sphere, material, filter, infoList))
         ret = true;
@@ -542,7 +544,7 @@ bool CCollidableOBBTree::AABoxCollision(const COBBTree::CNode& node, const zeus:
 
   const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
   if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
+    const_cast<CCollidableOBBTree&>(*this).m_nodesHit += 1;
     if (node.IsLeaf()) {
       if (AABoxCollideWithLeaf(node.GetLeafData(), xf, aabb, material, filter, planes, infoList))
         ret = true;
@@ -35,6 +35,8 @@ class CCollidableOBBTree : public CCollisionPrimitive {
   u32 x14_tries = 0;
   u32 x18_misses = 0;
   u32 x1c_hits = 0;
+  /* Tracked here rather than on the shared tree nodes so trees can be queried concurrently */
+  u32 m_nodesHit = 0;
   static inline u32 sTableIndex = 0;
   bool LineIntersectsLeaf(const COBBTree::CLeafData& leaf, CRayCastInfo& info) const;
   bool LineIntersectsOBBTree(const COBBTree::CNode& n0, const COBBTree::CNode& n1, CRayCastInfo& info) const;
@@ -78,7 +80,6 @@ public:
   CCollidableOBBTree(const COBBTree* tree, const CMaterialList& material);
   ~CCollidableOBBTree() override = default;
   void ResetTestStats() const;
-  void ResetTestStatsRecurse(const COBBTree::CNode&) const;
   u32 GetTableIndex() const override { return sTableIndex; }
   zeus::CAABox CalculateAABox(const zeus::CTransform&) const override;
   zeus::CAABox CalculateLocalAABox() const override;
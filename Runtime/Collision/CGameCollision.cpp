@@ -15,6 +15,13 @@
 #include "Runtime/World/CScriptPlatform.hpp"
 #include "Runtime/World/CWorld.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <utility>
+#include <vector>
+
 #include "TCastTo.hpp" // Generated file, do not modify include path
 
 namespace metaforce {
@@ -361,6 +368,161 @@ CRayCastResult CGameCollision::RayWorldIntersection(const CStateManager& mgr, TU
   return staticRes;
 }
 
+namespace {
+/* Spreads the low 10 bits of v three apart so three axes interleave into a Morton code */
+u32 MortonSpread(u32 v) {
+  v &= 0x3ff;
+  v = (v | (v << 16)) & 0x030000ff;
+  v = (v | (v << 8)) & 0x0300f00f;
+  v = (v | (v << 4)) & 0x030c30c3;
+  v = (v | (v << 2)) & 0x09249249;
+  return v;
+}
+
+/* Orders rays by direction octant, then by origin along a Z-curve, so each packet shares a traversal path */
+std::vector<u32> SortRaysCoherently(std::span<const SRayCastQuery> rays) {
+  std::array<float, 3> lo{FLT_MAX, FLT_MAX, FLT_MAX};
+  std::array<float, 3> hi{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+  for (const SRayCastQuery& ray : rays) {
+    for (int a = 0; a < 3; ++a) {
+      lo[a] = std::min(lo[a], ray.pos[a]);
+      hi[a] = std::max(hi[a], ray.pos[a]);
+    }
+  }
+
+  std::vector<std::pair<u64, u32>> keys;
+  keys.reserve(rays.size());
+  for (u32 i = 0; i < u32(rays.size()); ++i) {
+    const SRayCastQuery& ray = rays[i];
+    u64 key = 0;
+    for (int a = 0; a < 3; ++a) {
+      const float extent = hi[a] - lo[a];
+      const u32 cell = extent > 0.f ? u32((ray.pos[a] - lo[a]) / extent * 1023.f) : 0;
+      key |= u64(MortonSpread(cell)) << a;
+      key |= u64(ray.dir[a] < 0.f) << (30 + a);
+    }
+    keys.emplace_back(key, i);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<u32> order;
+  order.reserve(keys.size());
+  for (const auto& [key, idx] : keys) {
+    order.push_back(idx);
+  }
+  return order;
+}
+
+bool RaySegmentHitsBox(const zeus::CAABox& box, const zeus::CVector3f& pos, const zeus::CVector3f& dir, float length) {
+  float tNear = 0.f;
+  float tFar = length;
+  for (int a = 0; a < 3; ++a) {
+    if (std::fabs(dir[a]) <= FLT_MIN) {
+      if (pos[a] < box.min[a] || pos[a] > box.max[a]) {
+        return false;
+      }
+      continue;
+    }
+    const float recip = 1.f / dir[a];
+    float t0 = (box.min[a] - pos[a]) * recip;
+    float t1 = (box.max[a] - pos[a]) * recip;
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    tNear = std::max(tNear, t0);
+    tFar = std::min(tFar, t1);
+  }
+  return tNear <= tFar + 0.000099999997f;
+}
+} // Anonymous namespace
+
+void CGameCollision::RayStaticIntersectionBatch(const CStateManager& mgr, std::span<const SRayCastQuery> rays,
+                                                std::span<CRayCastResult> results) {
+  constexpr size_t kRaysPerPacket = CAreaOctTree::SRayPacket::kRaysPerPacket;
+  const std::vector<u32> order = SortRaysCoherently(rays);
+  CAreaOctTree::SRayPacket packet;
+
+  for (size_t base = 0; base < order.size(); base += kRaysPerPacket) {
+    const size_t count = std::min(kRaysPerPacket, order.size() - base);
+    packet.count = 0;
+    for (size_t i = 0; i < count; ++i) {
+      const SRayCastQuery& ray = rays[order[base + i]];
+      packet.AddRay(ray.pos, ray.dir, ray.length, ray.filter);
+    }
+
+    /* maxT carries over between areas, so later areas only report closer hits */
+    for (const CGameArea& area : *mgr.GetWorld()) {
+      area.GetPostConstructed()->x0_collision->LineTestExPacket(packet);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+      const SRayCastQuery& ray = rays[order[base + i]];
+      const CAreaOctTree::SRayResult& rayRes = packet.results[i];
+      if (rayRes.x10_surface) {
+        results[order[base + i]] = CRayCastResult(rayRes.x3c_t, ray.dir * rayRes.x3c_t + ray.pos, rayRes.x0_plane,
+                                                  rayRes.x10_surface->GetSurfaceFlags());
+      } else {
+        results[order[base + i]] = CRayCastResult();
+      }
+    }
+  }
+}
+
+void CGameCollision::RayDynamicIntersectionBatch(const CStateManager& mgr, std::span<const SRayCastQuery> rays,
+                                                 std::span<CRayCastResult> results, std::span<TUniqueId> idsOut,
+                                                 const EntityList& nearList) {
+  std::vector<float> bestT(rays.size());
+  for (size_t i = 0; i < rays.size(); ++i) {
+    bestT[i] = rays[i].length > 0.f ? rays[i].length : 100000.f;
+    results[i] = CRayCastResult();
+  }
+
+  /* Actor-major so each primitive transform is computed once; per ray this still keeps the
+   * first actor in nearList order with the lowest T, like RayDynamicIntersection */
+  for (TUniqueId id : nearList) {
+    const TCastToConstPtr<CPhysicsActor> physActor = mgr.GetObjectById(id);
+    if (!physActor) {
+      continue;
+    }
+    const zeus::CTransform xf = physActor->GetPrimitiveTransform();
+    const CCollisionPrimitive* prim = physActor->GetCollisionPrimitive();
+    const zeus::CAABox primBox = prim->CalculateAABox(xf);
+    const zeus::CAABox bounds(primBox.min - 0.01f, primBox.max + 0.01f);
+    for (size_t i = 0; i < rays.size(); ++i) {
+      const SRayCastQuery& ray = rays[i];
+      if (!RaySegmentHitsBox(bounds, ray.pos, ray.dir, bestT[i])) {
+        continue;
+      }
+      const CRayCastResult res = prim->CastRay(ray.pos, ray.dir, bestT[i], ray.filter, xf);
+      if (!res.IsInvalid() && res.GetT() < bestT[i]) {
+        bestT[i] = res.GetT();
+        results[i] = res;
+        if (!idsOut.empty()) {
+          idsOut[i] = physActor->GetUniqueId();
+        }
+      }
+    }
+  }
+}
+
+void CGameCollision::RayWorldIntersectionBatch(const CStateManager& mgr, std::span<const SRayCastQuery> rays,
+                                               std::span<CRayCastResult> results, std::span<TUniqueId> idsOut,
+                                               const EntityList& nearList) {
+  RayStaticIntersectionBatch(mgr, rays, results);
+  if (nearList.empty()) {
+    return;
+  }
+
+  std::vector<CRayCastResult> dynamicResults(rays.size());
+  RayDynamicIntersectionBatch(mgr, rays, dynamicResults, idsOut, nearList);
+  for (size_t i = 0; i < rays.size(); ++i) {
+    const CRayCastResult& dynamicRes = dynamicResults[i];
+    if (dynamicRes.IsValid() && (results[i].IsInvalid() || results[i].GetT() >= dynamicRes.GetT())) {
+      results[i] = dynamicRes;
+    }
+  }
+}
+
 bool CGameCollision::RayStaticIntersectionArea(const CGameArea& area, const zeus::CVector3f& pos,
                                                const zeus::CVector3f& dir, float mag, const CMaterialFilter& filter) {
   if (mag <= 0.f) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/rstl.hpp"
@@ -55,6 +56,17 @@ public:
   static CRayCastResult RayWorldIntersection(const CStateManager& mgr, TUniqueId& idOut, const zeus::CVector3f& pos,
                                              const zeus::CVector3f& dir, float mag, const CMaterialFilter& filter,
                                              const EntityList& nearList);
+  /* Batched forms of the above for callers that cast many rays at once. Rays are sorted into coherent
+   * packets that walk each area octree together, and each near actor is transformed and box-culled once
+   * per batch. results (and idsOut, if not empty) parallel rays; idsOut is only written on dynamic hits. */
+  static void RayStaticIntersectionBatch(const CStateManager& mgr, std::span<const SRayCastQuery> rays,
+                                         std::span<CRayCastResult> results);
+  static void RayDynamicIntersectionBatch(const CStateManager& mgr, std::span<const SRayCastQuery> rays,
+                                          std::span<CRayCastResult> results, std::span<TUniqueId> idsOut,
+                                          const EntityList& nearList);
+  static void RayWorldIntersectionBatch(const CStateManager& mgr, std::span<const SRayCastQuery> rays,
+                                        std::span<CRayCastResult> results, std::span<TUniqueId> idsOut,
+                                        const EntityList& nearList);
   static bool RayStaticIntersectionArea(const CGameArea& area, const zeus::CVector3f& pos, const zeus::CVector3f& dir,
                                         float mag, const CMaterialFilter& filter);
   static void BuildAreaCollisionCache(const CStateManager& mgr, CAreaCollisionCache& cache);
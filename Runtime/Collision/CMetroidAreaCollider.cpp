@@ -1,19 +1,24 @@
 #include "Runtime/Collision/CMetroidAreaCollider.hpp"
 
+#include <memory>
+
 #include "Runtime/Collision/CCollisionInfoList.hpp"
 #include "Runtime/Collision/CMaterialFilter.hpp"
 #include "Runtime/Collision/CollisionUtil.hpp"
 
 namespace metaforce {
 
-u32 CMetroidAreaCollider::g_CalledClip = 0;
-u32 CMetroidAreaCollider::g_RejectedByClip = 0;
-u32 CMetroidAreaCollider::g_TrianglesProcessed = 0;
-u32 CMetroidAreaCollider::g_DupTrianglesProcessed = 0;
-u16 CMetroidAreaCollider::g_DupPrimitiveCheckCount = 0;
-std::array<u16, 0x2800> CMetroidAreaCollider::g_DupVertexList{};
-std::array<u16, 0x6000> CMetroidAreaCollider::g_DupEdgeList{};
-std::array<u16, 0x4000> CMetroidAreaCollider::g_DupTriangleList{};
+namespace {
+/* Allocated on a thread's first query; threads that never collide don't pay for the lists */
+thread_local std::unique_ptr<CMetroidAreaCollider::SDupPrimitiveScratch> g_DupPrimitiveScratch;
+} // Anonymous namespace
+
+CMetroidAreaCollider::SDupPrimitiveScratch& CMetroidAreaCollider::GetScratch() {
+  if (!g_DupPrimitiveScratch) {
+    g_DupPrimitiveScratch = std::make_unique<SDupPrimitiveScratch>();
+  }
+  return *g_DupPrimitiveScratch;
+}
 
 CAABoxAreaCache::CAABoxAreaCache(const zeus::CAABox& aabb, const std::array<zeus::CPlane, 6>& pl,
                                  const CMaterialFilter& filter, const CMaterialList& material,
@@ -199,10 +204,11 @@ static zeus::CVector3f ClipRayToPlane(const zeus::CVector3f& a, const zeus::CVec
 
 bool CMetroidAreaCollider::ConvexPolyCollision(const std::array<zeus::CPlane, 6>& planes,
                                                const std::array<zeus::CVector3f, 3>& verts, zeus::CAABox& aabb) {
+  SDupPrimitiveScratch& scratch = GetScratch();
   std::array<rstl::reserved_vector<zeus::CVector3f, 20>, 2> vecs;
 
-  g_CalledClip += 1;
-  g_RejectedByClip -= 1;
+  scratch.m_calledClip += 1;
+  scratch.m_rejectedByClip -= 1;
 
   vecs[0].push_back(verts[0]);
   vecs[0].push_back(verts[1]);
@@ -237,19 +243,20 @@ bool CMetroidAreaCollider::ConvexPolyCollision(const std::array<zeus::CPlane, 6>
   for (const zeus::CVector3f& point : accumVec)
     aabb.accumulateBounds(point);
 
-  g_RejectedByClip -= 1;
+  scratch.m_rejectedByClip -= 1;
   return true;
 }
 
 bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Cached(const COctreeLeafCache& leafCache,
                                                              const zeus::CAABox& aabb, const CMaterialFilter& filter) {
+  SDupPrimitiveScratch& scratch = GetScratch();
   CBooleanAABoxAreaCache cache(aabb, filter);
 
   for (const CAreaOctTree::Node& node : leafCache.x4_nodeCache) {
     if (cache.x0_aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++scratch.m_trianglesProcessed;
         CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(list.GetAt(j));
         if (cache.x4_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
           if (CollisionUtil::TriBoxOverlap(cache.x8_center, cache.x14_halfExtent, surf.GetVert(0), surf.GetVert(1),
@@ -264,7 +271,8 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Cached(const COctreeLeafCa
 }
 
 bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node,
-                                                               const CBooleanAABoxAreaCache& cache) {
+                                                               const CBooleanAABoxAreaCache& cache,
+                                                               SDupPrimitiveScratch& scratch) {
   for (int i = 0; i < 8; ++i) {
     CAreaOctTree::Node::ETreeType type = node.GetChildType(i);
     if (type != CAreaOctTree::Node::ETreeType::Invalid) {
@@ -273,7 +281,7 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTre
         if (type == CAreaOctTree::Node::ETreeType::Leaf) {
           CAreaOctTree::TriListReference list = ch.GetTriangleArray();
           for (int j = 0; j < list.GetSize(); ++j) {
-            ++g_TrianglesProcessed;
+            ++scratch.m_trianglesProcessed;
             CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(list.GetAt(j));
             if (cache.x4_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
               if (CollisionUtil::TriBoxOverlap(cache.x8_center, cache.x14_halfExtent, surf.GetVert(0), surf.GetVert(1),
@@ -282,7 +290,7 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTre
             }
           }
         } else {
-          if (AABoxCollisionCheckBoolean_Internal(ch, cache))
+          if (AABoxCollisionCheckBoolean_Internal(ch, cache, scratch))
             return true;
         }
       }
@@ -294,19 +302,20 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTre
 bool CMetroidAreaCollider::AABoxCollisionCheckBoolean(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
                                                       const CMaterialFilter& filter) {
   CBooleanAABoxAreaCache cache(aabb, filter);
-  return AABoxCollisionCheckBoolean_Internal(octTree.GetRootNode(), cache);
+  return AABoxCollisionCheckBoolean_Internal(octTree.GetRootNode(), cache, GetScratch());
 }
 
 bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Cached(const COctreeLeafCache& leafCache,
                                                               const zeus::CAABox& aabb, const zeus::CSphere& sphere,
                                                               const CMaterialFilter& filter) {
+  SDupPrimitiveScratch& scratch = GetScratch();
   CBooleanSphereAreaCache cache(aabb, sphere, filter);
 
   for (const CAreaOctTree::Node& node : leafCache.x4_nodeCache) {
     if (cache.x0_aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++scratch.m_trianglesProcessed;
         CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(list.GetAt(j));
         if (cache.x8_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
           if (CollisionUtil::TriSphereOverlap(cache.x4_sphere, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
@@ -320,7 +329,8 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Cached(const COctreeLeafC
 }
 
 bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node,
-                                                                const CBooleanSphereAreaCache& cache) {
+                                                                const CBooleanSphereAreaCache& cache,
+                                                                SDupPrimitiveScratch& scratch) {
   for (int i = 0; i < 8; ++i) {
     CAreaOctTree::Node::ETreeType type = node.GetChildType(i);
     if (type != CAreaOctTree::Node::ETreeType::Invalid) {
@@ -329,7 +339,7 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTr
         if (type == CAreaOctTree::Node::ETreeType::Leaf) {
           CAreaOctTree::TriListReference list = ch.GetTriangleArray();
           for (int j = 0; j < list.GetSize(); ++j) {
-            ++g_TrianglesProcessed;
+            ++scratch.m_trianglesProcessed;
             CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(list.GetAt(j));
             if (cache.x8_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
               if (CollisionUtil::TriSphereOverlap(cache.x4_sphere, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
@@ -337,7 +347,7 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTr
             }
           }
         } else {
-          if (SphereCollisionCheckBoolean_Internal(ch, cache))
+          if (SphereCollisionCheckBoolean_Internal(ch, cache, scratch))
             return true;
         }
       }
@@ -350,7 +360,7 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean(const CAreaOctTree& octTr
                                                        const zeus::CSphere& sphere, const CMaterialFilter& filter) {
   CAreaOctTree::Node node = octTree.GetRootNode();
   CBooleanSphereAreaCache cache(aabb, sphere, filter);
-  return SphereCollisionCheckBoolean_Internal(node, cache);
+  return SphereCollisionCheckBoolean_Internal(node, cache, GetScratch());
 }
 
 bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
@@ -367,18 +377,18 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(const COctreeLeafCache& le
   }};
   CAABoxAreaCache cache(aabb, planes, filter, matList, list);
 
-  ResetInternalCounters();
+  SDupPrimitiveScratch& scratch = ResetInternalCounters();
 
   for (const CAreaOctTree::Node& node : leafCache.x4_nodeCache) {
     if (aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference listRef = node.GetTriangleArray();
       for (int j = 0; j < listRef.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++scratch.m_trianglesProcessed;
         u16 triIdx = listRef.GetAt(j);
-        if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-          g_DupTrianglesProcessed += 1;
+        if (scratch.m_dupPrimitiveCheckCount == scratch.m_dupTriangleList[triIdx]) {
+          scratch.m_dupTrianglesProcessed += 1;
         } else {
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+          scratch.m_dupTriangleList[triIdx] = scratch.m_dupPrimitiveCheckCount;
           CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
           CMaterialList material(surf.GetSurfaceFlags());
           if (cache.x8_filter.Passes(material)) {
@@ -401,7 +411,8 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(const COctreeLeafCache& le
   return ret;
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node& node, const CAABoxAreaCache& cache) {
+bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node& node, const CAABoxAreaCache& cache,
+                                                        SDupPrimitiveScratch& scratch) {
   bool ret = false;
 
   switch (node.GetTreeType()) {
@@ -411,7 +422,7 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node
     for (int i = 0; i < 8; ++i) {
       CAreaOctTree::Node ch = node.GetChild(i);
       if (ch.GetBoundingBox().intersects(cache.x0_aabb))
-        if (AABoxCollisionCheck_Internal(ch, cache))
+        if (AABoxCollisionCheck_Internal(ch, cache, scratch))
           ret = true;
     }
     break;
@@ -419,12 +430,12 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node
   case CAreaOctTree::Node::ETreeType::Leaf: {
     CAreaOctTree::TriListReference list = node.GetTriangleArray();
     for (int j = 0; j < list.GetSize(); ++j) {
-      ++g_TrianglesProcessed;
+      ++scratch.m_trianglesProcessed;
       u16 triIdx = list.GetAt(j);
-      if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-        g_DupTrianglesProcessed += 1;
+      if (scratch.m_dupPrimitiveCheckCount == scratch.m_dupTriangleList[triIdx]) {
+        scratch.m_dupTrianglesProcessed += 1;
       } else {
-        g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+        scratch.m_dupTriangleList[triIdx] = scratch.m_dupPrimitiveCheckCount;
         CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
         CMaterialList material(surf.GetSurfaceFlags());
         if (cache.x8_filter.Passes(material)) {
@@ -463,16 +474,16 @@ bool CMetroidAreaCollider::AABoxCollisionCheck(const CAreaOctTree& octTree, cons
   }};
   const CAABoxAreaCache cache(aabb, planes, filter, matList, list);
 
-  ResetInternalCounters();
+  SDupPrimitiveScratch& scratch = ResetInternalCounters();
 
   const CAreaOctTree::Node node = octTree.GetRootNode();
-  return AABoxCollisionCheck_Internal(node, cache);
+  return AABoxCollisionCheck_Internal(node, cache, scratch);
 }
 
 bool CMetroidAreaCollider::SphereCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
                                                        const zeus::CSphere& sphere, const CMaterialList& matList,
                                                        const CMaterialFilter& filter, CCollisionInfoList& clist) {
-  ResetInternalCounters();
+  SDupPrimitiveScratch& scratch = ResetInternalCounters();
 
   bool ret = false;
   zeus::CVector3f point, normal;
@@ -481,12 +492,12 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Cached(const COctreeLeafCache& l
     if (aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++scratch.m_trianglesProcessed;
         u16 triIdx = list.GetAt(j);
-        if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-          g_DupTrianglesProcessed += 1;
+        if (scratch.m_dupPrimitiveCheckCount == scratch.m_dupTriangleList[triIdx]) {
+          scratch.m_dupTrianglesProcessed += 1;
         } else {
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+          scratch.m_dupTriangleList[triIdx] = scratch.m_dupPrimitiveCheckCount;
           CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
           CMaterialList material(surf.GetSurfaceFlags());
           if (filter.Passes(material)) {
@@ -505,8 +516,8 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Cached(const COctreeLeafCache& l
   return ret;
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Node& node,
-                                                         const CSphereAreaCache& cache) {
+bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Node& node, const CSphereAreaCache& cache,
+                                                         SDupPrimitiveScratch& scratch) {
   bool ret = false;
   zeus::CVector3f point, normal;
 
@@ -518,12 +529,12 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Nod
         if (chTp == CAreaOctTree::Node::ETreeType::Leaf) {
           CAreaOctTree::TriListReference list = ch.GetTriangleArray();
           for (int j = 0; j < list.GetSize(); ++j) {
-            ++g_TrianglesProcessed;
+            ++scratch.m_trianglesProcessed;
             u16 triIdx = list.GetAt(j);
-            if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-              g_DupTrianglesProcessed += 1;
+            if (scratch.m_dupPrimitiveCheckCount == scratch.m_dupTriangleList[triIdx]) {
+              scratch.m_dupTrianglesProcessed += 1;
             } else {
-              g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+              scratch.m_dupTriangleList[triIdx] = scratch.m_dupPrimitiveCheckCount;
               CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(triIdx);
               CMaterialList material(surf.GetSurfaceFlags());
               if (cache.x8_filter.Passes(material)) {
@@ -537,7 +548,7 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Nod
             }
           }
         } else {
-          if (SphereCollisionCheck_Internal(ch, cache))
+          if (SphereCollisionCheck_Internal(ch, cache, scratch))
             ret = true;
         }
       }
@@ -551,9 +562,9 @@ bool CMetroidAreaCollider::SphereCollisionCheck(const CAreaOctTree& octTree, con
                                                 const zeus::CSphere& sphere, const CMaterialList& matList,
                                                 const CMaterialFilter& filter, CCollisionInfoList& list) {
   CSphereAreaCache cache(aabb, sphere, filter, matList, list);
-  ResetInternalCounters();
+  SDupPrimitiveScratch& scratch = ResetInternalCounters();
   CAreaOctTree::Node node = octTree.GetRootNode();
-  return SphereCollisionCheck_Internal(node, cache);
+  return SphereCollisionCheck_Internal(node, cache, scratch);
 }
 
 bool CMetroidAreaCollider::MovingAABoxCollisionCheck_BoxVertexTri(
@@ -656,7 +667,7 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
                                                             const zeus::CVector3f& dir, float mag,
                                                             CCollisionInfo& infoOut, double& dOut) {
   bool ret = false;
-  ResetInternalCounters();
+  SDupPrimitiveScratch& scratch = ResetInternalCounters();
   dOut = mag;
 
   CMovingAABoxComponents components(aabb, dir);
@@ -676,9 +687,9 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
         u16 triIdx = list.GetAt(j);
-        if (g_DupPrimitiveCheckCount != g_DupTriangleList[triIdx]) {
-          g_TrianglesProcessed += 1;
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+        if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupTriangleList[triIdx]) {
+          scratch.m_trianglesProcessed += 1;
+          scratch.m_dupTriangleList[triIdx] = scratch.m_dupPrimitiveCheckCount;
           CMaterialList triMat(node.GetOwner().GetTriangleMaterial(triIdx));
           if (filter.Passes(triMat)) {
             std::array<u16, 3> vertIndices;
@@ -699,8 +710,8 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
 
               for (const u16 vertIdx : vertIndices) {
                 zeus::CVector3f vtx = node.GetOwner().GetVert(vertIdx);
-                if (g_DupPrimitiveCheckCount != g_DupVertexList[vertIdx]) {
-                  g_DupVertexList[vertIdx] = g_DupPrimitiveCheckCount;
+                if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupVertexList[vertIdx]) {
+                  scratch.m_dupVertexList[vertIdx] = scratch.m_dupPrimitiveCheckCount;
                   if (movedAABB.pointInside(vtx)) {
                     d = dOut;
                     if (MovingAABoxCollisionCheck_TriVertexBox(vtx, aabb, dir, d, normal, point) && d < dOut) {
@@ -717,8 +728,8 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
               const u16* edgeIndices = node.GetOwner().GetTriangleEdgeIndices(triIdx);
               for (int k = 0; k < 3; ++k) {
                 u16 edgeIdx = edgeIndices[k];
-                if (g_DupPrimitiveCheckCount != g_DupEdgeList[edgeIdx]) {
-                  g_DupEdgeList[edgeIdx] = g_DupPrimitiveCheckCount;
+                if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupEdgeList[edgeIdx]) {
+                  scratch.m_dupEdgeList[edgeIdx] = scratch.m_dupPrimitiveCheckCount;
                   CMaterialList edgeMat(node.GetOwner().GetEdgeMaterial(edgeIdx));
                   if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
                     d = dOut;
@@ -746,12 +757,12 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
               }
             } else {
               const u16* edgeIndices = node.GetOwner().GetTriangleEdgeIndices(triIdx);
-              g_DupEdgeList[edgeIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[2]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[2]] = g_DupPrimitiveCheckCount;
+              scratch.m_dupEdgeList[edgeIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupEdgeList[edgeIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupEdgeList[edgeIndices[2]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIndices[2]] = scratch.m_dupPrimitiveCheckCount;
             }
           }
         }
@@ -768,7 +779,7 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                                                              const CMaterialList& matList, const zeus::CVector3f& dir,
                                                              float mag, CCollisionInfo& infoOut, double& dOut) {
   bool ret = false;
-  ResetInternalCounters();
+  SDupPrimitiveScratch& scratch = ResetInternalCounters();
   dOut = mag;
 
   zeus::CAABox movedAABB = aabb;
@@ -784,9 +795,9 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
         u16 triIdx = list.GetAt(j);
-        if (g_DupPrimitiveCheckCount != g_DupTriangleList[triIdx]) {
-          g_TrianglesProcessed += 1;
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+        if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupTriangleList[triIdx]) {
+          scratch.m_trianglesProcessed += 1;
+          scratch.m_dupTriangleList[triIdx] = scratch.m_dupPrimitiveCheckCount;
           CMaterialList triMat(node.GetOwner().GetTriangleMaterial(triIdx));
           if (filter.Passes(triMat)) {
             std::array<u16, 3> vertIndices;
@@ -821,8 +832,8 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                 for (int k = 0; k < 3; ++k) {
                   if (intersects || outsideEdges[k]) {
                     u16 edgeIdx = edgeIndices[k];
-                    if (g_DupPrimitiveCheckCount != g_DupEdgeList[edgeIdx]) {
-                      g_DupEdgeList[edgeIdx] = g_DupPrimitiveCheckCount;
+                    if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupEdgeList[edgeIdx]) {
+                      scratch.m_dupEdgeList[edgeIdx] = scratch.m_dupPrimitiveCheckCount;
                       CMaterialList edgeMat(node.GetOwner().GetEdgeMaterial(edgeIdx));
                       if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
                         int nextIdx = (k + 1) % 3;
@@ -871,8 +882,8 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                 for (int k = 0; k < 3; ++k) {
                   u16 vertIdx = vertIndices[k];
                   if (testVert[k]) {
-                    if (g_DupPrimitiveCheckCount != g_DupVertexList[vertIdx]) {
-                      g_DupVertexList[vertIdx] = g_DupPrimitiveCheckCount;
+                    if (scratch.m_dupPrimitiveCheckCount != scratch.m_dupVertexList[vertIdx]) {
+                      scratch.m_dupVertexList[vertIdx] = scratch.m_dupPrimitiveCheckCount;
                       double d = dOut;
                       if (CollisionUtil::RaySphereIntersection_Double(zeus::CSphere(surf.GetVert(k), sphere.radius),
                                                                       sphere.position, dir, d) &&
@@ -885,7 +896,7 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                       }
                     }
                   } else {
-                    g_DupVertexList[vertIdx] = g_DupPrimitiveCheckCount;
+                    scratch.m_dupVertexList[vertIdx] = scratch.m_dupPrimitiveCheckCount;
                   }
                 }
 
@@ -900,12 +911,12 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
               }
             } else {
               const u16* edgeIndices = node.GetOwner().GetTriangleEdgeIndices(triIdx);
-              g_DupEdgeList[edgeIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[2]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[2]] = g_DupPrimitiveCheckCount;
+              scratch.m_dupEdgeList[edgeIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupEdgeList[edgeIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupEdgeList[edgeIndices[2]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIndices[0]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIndices[1]] = scratch.m_dupPrimitiveCheckCount;
+              scratch.m_dupVertexList[vertIndices[2]] = scratch.m_dupPrimitiveCheckCount;
             }
           }
         }
@@ -916,18 +927,20 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
   return ret;
 }
 
-void CMetroidAreaCollider::ResetInternalCounters() {
-  g_CalledClip = 0;
-  g_RejectedByClip = 0;
-  g_TrianglesProcessed = 0;
-  g_DupTrianglesProcessed = 0;
-  if (g_DupPrimitiveCheckCount == 0xffff) {
-    g_DupVertexList.fill(0);
-    g_DupEdgeList.fill(0);
-    g_DupTriangleList.fill(0);
-    g_DupPrimitiveCheckCount += 1;
+CMetroidAreaCollider::SDupPrimitiveScratch& CMetroidAreaCollider::ResetInternalCounters() {
+  SDupPrimitiveScratch& scratch = GetScratch();
+  scratch.m_calledClip = 0;
+  scratch.m_rejectedByClip = 0;
+  scratch.m_trianglesProcessed = 0;
+  scratch.m_dupTrianglesProcessed = 0;
+  if (scratch.m_dupPrimitiveCheckCount == 0xffff) {
+    scratch.m_dupVertexList.fill(0);
+    scratch.m_dupEdgeList.fill(0);
+    scratch.m_dupTriangleList.fill(0);
+    scratch.m_dupPrimitiveCheckCount += 1;
   }
-  g_DupPrimitiveCheckCount += 1;
+  scratch.m_dupPrimitiveCheckCount += 1;
+  return scratch;
 }
 
 void CAreaCollisionCache::ClearCache() {
@@ -88,20 +88,34 @@ public:
 
 class CMetroidAreaCollider {
   friend class CCollidableOBBTree;
-  static u32 g_CalledClip;
-  static u32 g_RejectedByClip;
-  static u32 g_TrianglesProcessed;
-  static u32 g_DupTrianglesProcessed;
-  static u16 g_DupPrimitiveCheckCount;
-  static std::array<u16, 0x2800> g_DupVertexList;
-  static std::array<u16, 0x6000> g_DupEdgeList;
-  static std::array<u16, 0x4000> g_DupTriangleList;
-  static bool AABoxCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node, const CBooleanAABoxAreaCache& cache);
-  static bool AABoxCollisionCheck_Internal(const CAreaOctTree::Node& node, const CAABoxAreaCache& cache);
-
-  static bool SphereCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node,
-                                                   const CBooleanSphereAreaCache& cache);
-  static bool SphereCollisionCheck_Internal(const CAreaOctTree::Node& node, const CSphereAreaCache& cache);
+
+public:
+  /* Duplicate-rejection state for the query in progress. Each thread has its own,
+   * so static collision queries can run concurrently on different threads. */
+  struct SDupPrimitiveScratch {
+    u32 m_calledClip = 0;
+    u32 m_rejectedByClip = 0;
+    u32 m_trianglesProcessed = 0;
+    u32 m_dupTrianglesProcessed = 0;
+    u16 m_dupPrimitiveCheckCount = 0;
+    std::array<u16, 0x2800> m_dupVertexList{};
+    std::array<u16, 0x6000> m_dupEdgeList{};
+    std::array<u16, 0x4000> m_dupTriangleList{};
+  };
+
+private:
+  static SDupPrimitiveScratch& GetScratch();
+  /* The recursive walks take the scratch their public entry point fetched, so the thread_local
+   * lookup happens once per query rather than once per node */
+  static bool AABoxCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node, const CBooleanAABoxAreaCache& cache,
+                                                  SDupPrimitiveScratch& scratch);
+  static bool AABoxCollisionCheck_Internal(const CAreaOctTree::Node& node, const CAABoxAreaCache& cache,
+                                           SDupPrimitiveScratch& scratch);
+
+  static bool SphereCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node, const CBooleanSphereAreaCache& cache,
+                                                   SDupPrimitiveScratch& scratch);
+  static bool SphereCollisionCheck_Internal(const CAreaOctTree::Node& node, const CSphereAreaCache& cache,
+                                            SDupPrimitiveScratch& scratch);
 
   static bool MovingAABoxCollisionCheck_BoxVertexTri(const CCollisionSurface& surf, const zeus::CAABox& aabb,
                                                      const rstl::reserved_vector<u32, 8>& vertIndices,
@@ -167,9 +181,10 @@ public:
                                                 const zeus::CSphere& sphere, const CMaterialFilter& filter,
                                                 const CMaterialList& matList, const zeus::CVector3f& dir, float mag,
                                                 CCollisionInfo& infoOut, double& dOut);
-  static void ResetInternalCounters();
-  static std::array<u16, 0x4000>& GetTriangleList() { return g_DupTriangleList; }
-  static u16 GetPrimitiveCheckCount() { return g_DupPrimitiveCheckCount; }
+  /* Starts a new query on this thread's scratch */
+  static SDupPrimitiveScratch& ResetInternalCounters();
+  static std::array<u16, 0x4000>& GetTriangleList() { return GetScratch().m_dupTriangleList; }
+  static u16 GetPrimitiveCheckCount() { return GetScratch().m_dupPrimitiveCheckCount; }
 };
 
 class CAreaCollisionCache {
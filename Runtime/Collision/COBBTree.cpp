@@ -51,8 +51,40 @@ COBBTree::COBBTree(CInputStream& in)
 : x0_magic(verify_deaf_babe(in))
 , x4_version(verify_version(in))
 , x8_memsize(in.ReadLong())
-, x18_indexData(in)
-, x88_root(std::make_unique<CNode>(in)) {}
+, x18_indexData(in) {
+  /* The file gives no node or surface counts up front, so drop the growth slack once everything is read */
+  ReadNode(in, m_nodes, m_leafSurfaces);
+  m_nodes.shrink_to_fit();
+  m_leafSurfaces.shrink_to_fit();
+  ResolveLeaves();
+}
+
+void COBBTree::ReadNode(CInputStream& in, std::vector<CNode>& nodes, std::vector<u16>& leafSurfaces) {
+  const size_t idx = nodes.size();
+  nodes.emplace_back();
+  nodes[idx].x0_obb = in.Get<zeus::COBBox>();
+  nodes[idx].x3c_isLeaf = in.ReadBool();
+  if (nodes[idx].x3c_isLeaf) {
+    const u32 count = in.ReadLong();
+    nodes[idx].offset = u32(leafSurfaces.size());
+    nodes[idx].leaf = CLeafData(nullptr, count);
+    for (u32 i = 0; i < count; ++i) {
+      leafSurfaces.push_back(in.ReadShort());
+    }
+  } else {
+    ReadNode(in, nodes, leafSurfaces);
+    nodes[idx].offset = u32(nodes.size() - idx);
+    ReadNode(in, nodes, leafSurfaces);
+  }
+}
+
+void COBBTree::ResolveLeaves() {
+  for (CNode& node : m_nodes) {
+    if (node.x3c_isLeaf) {
+      node.leaf = CLeafData(m_leafSurfaces.data() + node.offset, u32(node.leaf.GetSurfaceVector().size()));
+    }
+  }
+}
 
 std::unique_ptr<COBBTree> COBBTree::BuildOrientedBoundingBoxTree(const zeus::CVector3f& extent,
                                                                  const zeus::CVector3f& center) {
@@ -72,13 +104,15 @@ std::unique_ptr<COBBTree> COBBTree::BuildOrientedBoundingBoxTree(const zeus::CVe
   for (int i = 0; i < 8; ++i) {
     idxData.x60_vertices.push_back(aabb.getPoint(i));
   }
-  std::vector<u16> surface;
-  surface.reserve(12);
-  for (int i = 0; i < 12; ++i) {
-    surface.push_back(i);
+  ret->m_leafSurfaces.reserve(12);
+  for (u16 i = 0; i < 12; ++i) {
+    ret->m_leafSurfaces.push_back(i);
   }
-  ret->x88_root = std::make_unique<CNode>(zeus::CTransform::Translate(center), extent * 0.5f, nullptr, nullptr,
-                                          std::make_unique<CLeafData>(std::move(surface)));
+  CNode& root = ret->m_nodes.emplace_back();
+  root.x0_obb = zeus::COBBox(zeus::CTransform::Translate(center), extent * 0.5f);
+  root.x3c_isLeaf = true;
+  root.leaf = CLeafData(nullptr, u32(ret->m_leafSurfaces.size()));
+  ret->ResolveLeaves();
   return ret;
 }
 
@@ -151,8 +185,8 @@ CCollisionSurface COBBTree::GetTransformedSurface(u16 idx, const zeus::CTransfor
 zeus::CAABox COBBTree::CalculateLocalAABox() const { return CalculateAABox(zeus::CTransform()); }
 
 zeus::CAABox COBBTree::CalculateAABox(const zeus::CTransform& xf) const {
-  if (x88_root) {
-    return x88_root->GetOBB().calculateAABox(xf);
+  if (!m_nodes.empty()) {
+    return m_nodes.front().GetOBB().calculateAABox(xf);
   }
   return zeus::CAABox();
 }
@@ -193,53 +227,4 @@ COBBTree::SIndexData::SIndexData(CInputStream& in) {
   }
 }
 
-COBBTree::CNode::CNode(const zeus::CTransform& xf, const zeus::CVector3f& point, std::unique_ptr<CNode>&& left,
-                       std::unique_ptr<CNode>&& right, std::unique_ptr<CLeafData>&& leaf)
-: x0_obb(xf, point)
-, x3c_isLeaf(leaf != nullptr)
-, x40_left(std::move(left))
-, x44_right(std::move(right))
-, x48_leaf(std::move(leaf)) {}
-
-COBBTree::CNode::CNode(CInputStream& in) {
-  x0_obb = in.Get<zeus::COBBox>();
-  x3c_isLeaf = in.ReadBool();
-  if (x3c_isLeaf)
-    x48_leaf = std::make_unique<CLeafData>(in);
-  else {
-    x40_left = std::make_unique<CNode>(in);
-    x44_right = std::make_unique<CNode>(in);
-  }
-}
-
-size_t COBBTree::CNode::GetMemoryUsage() const {
-  size_t ret = 0;
-  if (x3c_isLeaf)
-    ret = x48_leaf->GetMemoryUsage() + /*sizeof(CNode)*/ 80;
-  else {
-    if (x40_left)
-      ret = x40_left->GetMemoryUsage() + /*sizeof(CNode)*/ 80;
-    if (x44_right)
-      ret += x44_right->GetMemoryUsage();
-  }
-
-  return (ret + 3) & ~3;
-}
-
-COBBTree::CLeafData::CLeafData(std::vector<u16>&& surface) : x0_surface(std::move(surface)) {}
-
-const std::vector<u16>& COBBTree::CLeafData::GetSurfaceVector() const { return x0_surface; }
-
-size_t COBBTree::CLeafData::GetMemoryUsage() const {
-  const size_t ret = (x0_surface.size() * 2) + /*sizeof(CLeafData)*/ 16;
-  return (ret + 3) & ~3;
-}
-
-COBBTree::CLeafData::CLeafData(CInputStream& in) {
-  const u32 edgeCount = in.ReadLong();
-  for (u32 i = 0; i < edgeCount; i++) {
-    x0_surface.emplace_back(in.ReadShort());
-  }
-}
-
 } // namespace metaforce
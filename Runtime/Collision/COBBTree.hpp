@@ -2,6 +2,7 @@
 
 #include <array>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "Runtime/RetroTypes.hpp"
@@ -28,39 +29,32 @@ public:
     explicit SIndexData(CInputStream&);
   };
 
+  /* View of a leaf's run in the tree's shared surface pool */
   class CLeafData {
-    std::vector<u16> x0_surface;
+    const u16* surfaces = nullptr;
+    u32 count = 0;
 
   public:
     CLeafData() = default;
-    explicit CLeafData(std::vector<u16>&& surface);
-    explicit CLeafData(CInputStream&);
+    CLeafData(const u16* surfaces, u32 count) : surfaces(surfaces), count(count) {}
 
-    const std::vector<u16>& GetSurfaceVector() const;
-    size_t GetMemoryUsage() const;
+    std::span<const u16> GetSurfaceVector() const { return {surfaces, count}; }
   };
 
+  /* Nodes live in one depth-first array: the left child directly follows its parent and the
+   * right child is found by offset, so traversal never chases heap pointers. */
   class CNode {
+    friend class COBBTree;
     zeus::COBBox x0_obb;
     bool x3c_isLeaf = false;
-    std::unique_ptr<CNode> x40_left;
-    std::unique_ptr<CNode> x44_right;
-    std::unique_ptr<CLeafData> x48_leaf;
-    bool x4c_hit = false;
+    u32 offset = 0; /* Branch: offset to right child, Leaf: start of surface run */
+    CLeafData leaf;
 
   public:
-    CNode() = default;
-    CNode(const zeus::CTransform&, const zeus::CVector3f&, std::unique_ptr<CNode>&&, std::unique_ptr<CNode>&&,
-          std::unique_ptr<CLeafData>&&);
-    explicit CNode(CInputStream&);
-
-    bool WasHit() const { return x4c_hit; }
-    void SetHit(bool h) { x4c_hit = h; }
-    const CNode& GetLeft() const { return *x40_left; }
-    const CNode& GetRight() const { return *x44_right; }
-    const CLeafData& GetLeafData() const { return *x48_leaf; }
+    const CNode& GetLeft() const { return this[1]; }
+    const CNode& GetRight() const { return this[offset]; }
+    const CLeafData& GetLeafData() const { return leaf; }
     const zeus::COBBox& GetOBB() const { return x0_obb; }
-    size_t GetMemoryUsage() const;
     bool IsLeaf() const { return x3c_isLeaf; }
   };
 
@@ -70,11 +64,18 @@ private:
   u32 x8_memsize = 0;
   /* CSimpleAllocator xc_ We're not using this but lets keep track*/
   SIndexData x18_indexData;
-  std::unique_ptr<CNode> x88_root;
+  std::vector<CNode> m_nodes;
+  std::vector<u16> m_leafSurfaces;
+
+  static void ReadNode(CInputStream& in, std::vector<CNode>& nodes, std::vector<u16>& leafSurfaces);
+  void ResolveLeaves();
 
 public:
   COBBTree() = default;
   explicit COBBTree(CInputStream&);
+  /* Leaves point into m_leafSurfaces */
+  COBBTree(const COBBTree&) = delete;
+  COBBTree& operator=(const COBBTree&) = delete;
 
   static std::unique_ptr<COBBTree> BuildOrientedBoundingBoxTree(const zeus::CVector3f&, const zeus::CVector3f&);
   CCollisionSurface GetSurface(u16 idx) const;
@@ -90,7 +91,7 @@ public:
   CCollisionSurface GetTransformedSurface(u16 idx, const zeus::CTransform& xf) const;
   zeus::CAABox CalculateLocalAABox() const;
   zeus::CAABox CalculateAABox(const zeus::CTransform&) const;
-  const CNode& GetRoot() const { return *x88_root; }
+  const CNode& GetRoot() const { return m_nodes.front(); }
   u32 NumSurfaceMaterials() const { return x18_indexData.x30_surfaceMaterials.size(); }
 };
 } // namespace metaforce
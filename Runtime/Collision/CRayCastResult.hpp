@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Runtime/GCNTypes.hpp"
+#include "Runtime/Collision/CMaterialFilter.hpp"
 #include "Runtime/Collision/CMaterialList.hpp"
 
 #include <zeus/CPlane.hpp>
@@ -42,4 +43,12 @@ public:
 
   void Transform(const zeus::CTransform&);
 };
+
+/* One ray of a batched query, see CGameCollision::RayWorldIntersectionBatch */
+struct SRayCastQuery {
+  zeus::CVector3f pos;
+  zeus::CVector3f dir;
+  float length;
+  CMaterialFilter filter;
+};
 } // namespace metaforce
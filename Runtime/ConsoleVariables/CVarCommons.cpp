@@ -26,6 +26,11 @@ CVarCommons::CVarCommons(CVarManager& manager) : m_mgr(manager) {
                                       (CVar::EFlags::System | CVar::EFlags::Archive));
   m_windowPos = m_mgr.findOrMakeCVar("windowPos", "Stores the last known window position", zeus::CVector2i(-1, -1),
                                      (CVar::EFlags::System | CVar::EFlags::Archive));
+  m_dvdReaderThreads = m_mgr.findOrMakeCVar("dvdReaderThreads"sv, "Number of threads servicing disc read requests"sv, 2,
+                                            CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
+  m_dvdMemoryMap = m_mgr.findOrMakeCVar(
+      "dvdMemoryMap"sv, "Memory-map raw disc images to load uncompressed resources without copying"sv, true,
+      CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
 
   m_debugOverlayPlayerInfo = m_mgr.findOrMakeCVar(
       "debugOverlay.playerInfo"sv, "Displays information about the player, such as location and orientation"sv, false,
@@ -58,6 +63,9 @@ CVarCommons::CVarCommons(CVarManager& manager) : m_mgr(manager) {
   m_debugOverlayShowRandomStats =
       m_mgr.findOrMakeCVar("debugOverlay.showRandomStats", "Displays the current number of random calls per frame"sv,
                            false, CVar::EFlags::Game | CVar::EFlags::Archive | CVar::EFlags::ReadOnly);
+  m_debugOverlayShowUpdateBucketStats = m_mgr.findOrMakeCVar(
+      "debugOverlay.showUpdateBucketStats"sv, "Displays per-frame update counts and times for each entity bucket"sv,
+      false, CVar::EFlags::Game | CVar::EFlags::Archive | CVar::EFlags::ReadOnly);
   m_debugOverlayPipelineInfo =
       m_mgr.findOrMakeCVar("debugOverlay.pipelineInfo"sv, "Displays the current pipeline memory usage per frame"sv,
                            false, CVar::EFlags::Game | CVar::EFlags::Archive | CVar::EFlags::ReadOnly);
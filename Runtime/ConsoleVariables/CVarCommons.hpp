@@ -30,6 +30,8 @@ struct CVarCommons {
   CVar* m_variableDt = nullptr;
   CVar* m_windowSize = nullptr;
   CVar* m_windowPos = nullptr;
+  CVar* m_dvdReaderThreads = nullptr;
+  CVar* m_dvdMemoryMap = nullptr;
 
   CVar* m_debugOverlayPlayerInfo = nullptr;
   CVar* m_debugOverlayWorldInfo = nullptr;
@@ -40,6 +42,7 @@ struct CVarCommons {
   CVar* m_debugOverlayShowInGameTime = nullptr;
   CVar* m_debugOverlayShowResourceStats = nullptr;
   CVar* m_debugOverlayShowRandomStats = nullptr;
+  CVar* m_debugOverlayShowUpdateBucketStats = nullptr;
   CVar* m_debugOverlayShowRoomTimer = nullptr;
   CVar* m_debugOverlayPipelineInfo = nullptr;
   CVar* m_debugOverlayDrawCallInfo = nullptr;
@@ -80,6 +83,10 @@ struct CVarCommons {
 
   void setDeepColor(bool b) { m_deepColor->fromBoolean(b); }
 
+  uint32_t getDvdReaderThreads() const { return std::max(1u, m_dvdReaderThreads->toUnsigned()); }
+
+  bool getDvdMemoryMap() const { return m_dvdMemoryMap->toBoolean(); }
+
   bool getVariableFrameTime() const { return m_variableDt->toBoolean(); }
 
   void setVariableFrameTime(bool b) { m_variableDt->fromBoolean(b); }
@@ -3,6 +3,7 @@
 #include "Runtime/Camera/CGameCamera.hpp"
 #include "Runtime/World/CGameLight.hpp"
 #include "Runtime/World/CPatterned.hpp"
+#include "Runtime/World/CScriptEffect.hpp"
 #include "Runtime/World/CScriptAiJumpPoint.hpp"
 #include "Runtime/World/CScriptCoverPoint.hpp"
 #include "Runtime/World/CScriptDoor.hpp"
@@ -51,4 +52,52 @@ CGameLightList::CGameLightList() : CObjectList(EGameObjectList::GameLight) {}
 
 bool CGameLightList::IsQualified(const CEntity& lt) const { return TCastToConstPtr<CGameLight>(lt).IsValid(); }
 
+CEntityUpdateList::CEntityUpdateList() {
+  m_entries.reserve(kMaxEntities);
+  m_entryIdx.fill(UINT32_MAX);
+}
+
+void CEntityUpdateList::AddObject(CEntity& ent) {
+  EUpdateBucket bucket = EUpdateBucket::Generic;
+  if (TCastToConstPtr<CGameCamera>(ent)) {
+    bucket = EUpdateBucket::Camera;
+  } else if (TCastToConstPtr<CPatterned>(ent)) {
+    bucket = EUpdateBucket::Patterned;
+  } else if (TCastToConstPtr<CScriptEffect>(ent)) {
+    bucket = EUpdateBucket::Effect;
+  }
+  m_entryIdx[ent.GetUniqueId().Value()] = u32(m_entries.size());
+  m_entries.push_back({&ent, bucket});
+  ++m_counts[size_t(bucket)];
+}
+
+void CEntityUpdateList::RemoveObject(TUniqueId uid) {
+  if (uid == kInvalidUniqueId) {
+    return;
+  }
+  u32& idx = m_entryIdx[uid.Value()];
+  if (idx == UINT32_MAX) {
+    return;
+  }
+  SEntry& entry = m_entries[idx];
+  if (entry.ent->GetUniqueId() != uid) {
+    return;
+  }
+  --m_counts[size_t(entry.bucket)];
+  entry.ent = nullptr;
+  idx = UINT32_MAX;
+  m_hasHoles = true;
+}
+
+void CEntityUpdateList::Compact() {
+  if (!m_hasHoles) {
+    return;
+  }
+  std::erase_if(m_entries, [](const SEntry& entry) { return entry.ent == nullptr; });
+  for (size_t i = 0; i < m_entries.size(); ++i) {
+    m_entryIdx[m_entries[i].ent->GetUniqueId().Value()] = u32(i);
+  }
+  m_hasHoles = false;
+}
+
 } // namespace metaforce
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "Runtime/CObjectList.hpp"
 
 namespace metaforce {
@@ -51,4 +54,45 @@ public:
   bool IsQualified(const CEntity&) const override;
 };
 
+enum class EUpdateBucket : u8 { Generic, Patterned, Effect, Camera, MAX };
+
+/* Dense copy of the all-object list for the per-frame update loops. Each entity's bucket is worked out once
+ * when it is added, so the loops scan an array instead of following links and casting every entity.
+ * Entries are kept in insertion order and walked newest first, the order the all-object list's head
+ * insertion gives. */
+class CEntityUpdateList {
+public:
+  struct SEntry {
+    CEntity* ent;
+    EUpdateBucket bucket;
+  };
+
+private:
+  std::vector<SEntry> m_entries;
+  std::array<u32, kMaxEntities> m_entryIdx;
+  std::array<u16, size_t(EUpdateBucket::MAX)> m_counts{};
+  bool m_hasHoles = false;
+
+  void Compact();
+
+public:
+  CEntityUpdateList();
+
+  void AddObject(CEntity& ent);
+  void RemoveObject(TUniqueId uid);
+  u16 GetBucketCount(EUpdateBucket bucket) const { return m_counts[size_t(bucket)]; }
+
+  /* Objects added during the walk are left for the next one, as they would be at the head of the linked list */
+  template <typename Func>
+  void ForEach(Func&& func) {
+    Compact();
+    for (size_t i = m_entries.size(); i-- > 0;) {
+      const SEntry entry = m_entries[i];
+      if (entry.ent != nullptr) {
+        func(entry);
+      }
+    }
+  }
+};
+
 } // namespace metaforce
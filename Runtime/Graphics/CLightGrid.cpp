@@ -0,0 +1,136 @@
+#include "Runtime/Graphics/CLightGrid.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace metaforce {
+
+std::array<u32, 3> CLightGrid::CellOf(const zeus::CVector3f& point) const {
+  std::array<u32, 3> ret;
+  for (size_t a = 0; a < 3; ++a) {
+    /* Written so NaN lands in cell 0 */
+    const float cell = std::floor((point[a] - m_min[a]) * m_invCellSize);
+    ret[a] = cell > 0.f ? u32(std::min(cell, float(m_dims[a] - 1))) : 0;
+  }
+  return ret;
+}
+
+void CLightGrid::Clear() {
+  m_dims = {};
+  m_cellStarts.clear();
+  m_cellLights.clear();
+  m_everywhere.clear();
+}
+
+void CLightGrid::Build(std::span<const CLight> lights, float radiusScale) {
+  Clear();
+
+  struct SBounds {
+    u16 idx;
+    zeus::CVector3f min;
+    zeus::CVector3f max;
+  };
+  std::vector<SBounds> bounded;
+  bounded.reserve(lights.size());
+  zeus::CVector3f gridMin(FLT_MAX);
+  zeus::CVector3f gridMax(-FLT_MAX);
+  for (size_t i = 0; i < lights.size(); ++i) {
+    const CLight& light = lights[i];
+    const zeus::CVector3f& pos = light.GetPosition();
+    const float radius = light.GetRadius() * radiusScale;
+    if (light.GetType() == ELightType::LocalAmbient || !(radius < kMaxGridRadius) || !std::isfinite(pos.x()) ||
+        !std::isfinite(pos.y()) || !std::isfinite(pos.z())) {
+      m_everywhere.push_back(u16(i));
+      continue;
+    }
+    const SBounds& b =
+        bounded.emplace_back(SBounds{u16(i), pos - zeus::CVector3f(radius), pos + zeus::CVector3f(radius)});
+    for (size_t a = 0; a < 3; ++a) {
+      gridMin[a] = std::min(gridMin[a], b.min[a]);
+      gridMax[a] = std::max(gridMax[a], b.max[a]);
+    }
+  }
+  if (bounded.empty()) {
+    return;
+  }
+
+  const zeus::CVector3f extent = gridMax - gridMin;
+  const float cellSize = std::max({extent.x(), extent.y(), extent.z(), 1.f}) / float(kMaxCellsPerAxis);
+  m_min = gridMin;
+  m_invCellSize = 1.f / cellSize;
+  for (size_t a = 0; a < 3; ++a) {
+    m_dims[a] = std::clamp(u32(std::ceil(extent[a] * m_invCellSize)), 1u, kMaxCellsPerAxis);
+  }
+
+  /* Bucket into cells in two passes so each cell's run stays in list order */
+  const u32 cellCount = m_dims[0] * m_dims[1] * m_dims[2];
+  m_cellStarts.assign(cellCount + 1, 0);
+  std::vector<std::pair<std::array<u32, 3>, std::array<u32, 3>>> ranges;
+  ranges.reserve(bounded.size());
+  for (const SBounds& b : bounded) {
+    const auto& [lo, hi] = ranges.emplace_back(CellOf(b.min), CellOf(b.max));
+    if ((hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1) > kMaxCellsPerLight) {
+      continue;
+    }
+    for (u32 z = lo[2]; z <= hi[2]; ++z) {
+      for (u32 y = lo[1]; y <= hi[1]; ++y) {
+        for (u32 x = lo[0]; x <= hi[0]; ++x) {
+          ++m_cellStarts[(z * m_dims[1] + y) * m_dims[0] + x + 1];
+        }
+      }
+    }
+  }
+  for (u32 c = 0; c < cellCount; ++c) {
+    m_cellStarts[c + 1] += m_cellStarts[c];
+  }
+
+  m_cellLights.resize(m_cellStarts.back());
+  std::vector<u32> cursor(m_cellStarts.begin(), m_cellStarts.end() - 1);
+  for (size_t i = 0; i < bounded.size(); ++i) {
+    const auto& [lo, hi] = ranges[i];
+    if ((hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1) > kMaxCellsPerLight) {
+      m_everywhere.push_back(bounded[i].idx);
+      continue;
+    }
+    for (u32 z = lo[2]; z <= hi[2]; ++z) {
+      for (u32 y = lo[1]; y <= hi[1]; ++y) {
+        for (u32 x = lo[0]; x <= hi[0]; ++x) {
+          m_cellLights[cursor[(z * m_dims[1] + y) * m_dims[0] + x]++] = bounded[i].idx;
+        }
+      }
+    }
+  }
+  std::sort(m_everywhere.begin(), m_everywhere.end());
+}
+
+void CLightGrid::Query(const zeus::CAABox& aabb, std::vector<u16>& out) const {
+  out.assign(m_everywhere.begin(), m_everywhere.end());
+  if (m_cellStarts.empty()) {
+    return;
+  }
+
+  const std::array<u32, 3> lo = CellOf(aabb.min);
+  const std::array<u32, 3> hi = CellOf(aabb.max);
+  u32 runs = m_everywhere.empty() ? 0 : 1;
+  for (u32 z = lo[2]; z <= hi[2]; ++z) {
+    for (u32 y = lo[1]; y <= hi[1]; ++y) {
+      for (u32 x = lo[0]; x <= hi[0]; ++x) {
+        const u32 cell = (z * m_dims[1] + y) * m_dims[0] + x;
+        if (m_cellStarts[cell] != m_cellStarts[cell + 1]) {
+          out.insert(out.end(), m_cellLights.begin() + m_cellStarts[cell],
+                     m_cellLights.begin() + m_cellStarts[cell + 1]);
+          ++runs;
+        }
+      }
+    }
+  }
+
+  /* A single run is already ascending and unique */
+  if (runs > 1) {
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+  }
+}
+
+} // namespace metaforce
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+#include "Runtime/Graphics/CLight.hpp"
+
+#include <zeus/CAABox.hpp>
+#include <zeus/CVector3f.hpp>
+
+namespace metaforce {
+
+/* Uniform grid over light influence spheres, so finding the lights that can reach an actor's bounds only
+ * looks at the cells those bounds cover. Queries return a superset of the lights whose sphere touches the
+ * box, in list order; callers still do their exact test. Ambient lights, unattenuated lights and spheres
+ * too big for the grid are returned by every query. */
+class CLightGrid {
+  static constexpr u32 kMaxCellsPerAxis = 16;
+  static constexpr u32 kMaxCellsPerLight = 64;
+  /* Bigger spheres would stretch the grid over empty space, so they are returned by every query instead */
+  static constexpr float kMaxGridRadius = 1000.f;
+
+  zeus::CVector3f m_min;
+  float m_invCellSize = 0.f;
+  std::array<u32, 3> m_dims{};
+  std::vector<u32> m_cellStarts;
+  std::vector<u16> m_cellLights;
+  std::vector<u16> m_everywhere;
+
+  std::array<u32, 3> CellOf(const zeus::CVector3f& point) const;
+
+public:
+  /* radiusScale matches the sphere the caller tests against, e.g. 2 for area lights */
+  void Build(std::span<const CLight> lights, float radiusScale);
+  void Clear();
+
+  /* Fills out with candidate indices into the light list, ascending and without duplicates */
+  void Query(const zeus::CAABox& aabb, std::vector<u16>& out) const;
+};
+
+} // namespace metaforce
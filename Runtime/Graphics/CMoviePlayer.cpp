@@ -751,7 +751,8 @@ void CMoviePlayer::ReadCompleted() {
 void CMoviePlayer::PostDVDReadRequestIfNeeded() {
   if (xc0_curLoadFrame < x28_thpHead.numFrames) {
     x90_requestBuf.reset(new uint8_t[xb0_nextReadSize]);
-    x98_request = AsyncSeekRead(x90_requestBuf.get(), xb0_nextReadSize, ESeekOrigin::Begin, xb4_nextReadOff);
+    x98_request = AsyncSeekRead(x90_requestBuf.get(), xb0_nextReadSize, ESeekOrigin::Begin, xb4_nextReadOff, {},
+                                EDvdPriority::AudioStream);
   }
 }
 
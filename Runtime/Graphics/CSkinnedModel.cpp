@@ -51,8 +51,8 @@ void CSkinnedModel::Calculate(const CPoseAsTransforms& pose, CVertexMorphEffect*
   }
 
   x10_skinRules->BuildAccumulatedTransforms(pose, *x1c_layoutInfo);
-  x10_skinRules->BuildPoints(x4_model->GetPositions(), &workspace->m_vertexWorkspace);
-  x10_skinRules->BuildNormals(x4_model->GetNormals(), &workspace->m_normalWorkspace);
+  x10_skinRules->BuildPointsAndNormals(x4_model->GetPositions(), x4_model->GetNormals(), &workspace->m_vertexWorkspace,
+                                       &workspace->m_normalWorkspace);
 
   if (morphEffect) {
     morphEffect->MorphVertices(*workspace, averagedNormals, x10_skinRules, pose, x10_skinRules->GetVertexCount());
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "Runtime/RetroTypes.hpp"
@@ -24,6 +25,27 @@ using FMemFactoryFunc =
     std::function<CFactoryFnReturn(const metaforce::SObjectTag& tag, std::unique_ptr<u8[]>&& in, u32 len,
                                    const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef)>;
 
+/* Historical cost of building one resource type, accumulated by asynchronous loaders */
+struct SResourceCost {
+  u32 count = 0;
+  u64 bytes = 0;
+  std::chrono::nanoseconds asyncTime{};    // Decompression/construction on worker threads
+  std::chrono::nanoseconds finalizeTime{}; // Main-thread work in AsyncIdle
+  std::chrono::nanoseconds maxFinalizeTime{};
+
+  /* Expected main-thread time for a resource of this type and size; unknown types estimate zero */
+  std::chrono::nanoseconds EstimateFinalize(u32 size) const {
+    if (count == 0) {
+      return {};
+    }
+    /* Blend the per-item average with a per-byte rate; neither alone fits both tiny and huge assets */
+    const auto perItem = finalizeTime / count;
+    const auto perByte = bytes != 0 ? std::chrono::nanoseconds(finalizeTime.count() * size / s64(bytes)) : perItem;
+    return (perItem + perByte) / 2;
+  }
+};
+using ResourceCostTable = std::unordered_map<FourCC, SResourceCost>;
+
 class IFactory {
 public:
   virtual ~IFactory() = default;
@@ -39,6 +61,7 @@ public:
   virtual CResLoader* GetResLoader() { return nullptr; }
   virtual CFactoryMgr* GetFactoryMgr() { return nullptr; }
   virtual bool AsyncIdle(std::chrono::nanoseconds target) { return false; }
+  virtual const ResourceCostTable* GetResourceCostTable() const { return nullptr; }
 
   /* Non-factory versions, replaces CResLoader */
   virtual u32 ResourceSize(const metaforce::SObjectTag& tag) = 0;
@@ -9,6 +9,7 @@
 
 #include "../version.h"
 #include "MP1/MP1.hpp"
+#include "Runtime/CDvdFile.hpp"
 #include "Runtime/CStateManager.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
 #include "Runtime/ImGuiEntitySupport.hpp"
@@ -816,8 +817,8 @@ void ImGuiConsole::ShowDebugOverlay() {
   if (!m_developer && !m_frameCounter && !m_frameRate && !m_inGameTime && !m_roomTimer) {
     return;
   }
-  if (!m_playerInfo && !m_areaInfo && !m_worldInfo && !m_randomStats && !m_resourceStats && !m_pipelineInfo &&
-      !m_drawCallInfo && !m_bufferInfo) {
+  if (!m_playerInfo && !m_areaInfo && !m_worldInfo && !m_randomStats && !m_updateBucketStats &&
+      !m_resourceStats && !m_pipelineInfo && !m_drawCallInfo && !m_bufferInfo) {
     return;
   }
   ImGuiIO& io = ImGui::GetIO();
@@ -966,6 +967,24 @@ void ImGuiConsole::ShowDebugOverlay() {
           fmt::format(FMT_STRING("CRandom16::Next calls: {}\n"), metaforce::CRandom16::GetNumNextCalls()));
       ImGuiStringViewText(fmt::format(FMT_STRING("CRandom16::LastSeed: 0x{:08X}\n"), CRandom16::GetLastSeed()));
     }
+    if (m_updateBucketStats && g_StateManager != nullptr) {
+      if (hasPrevious) {
+        ImGui::Separator();
+      }
+      hasPrevious = true;
+
+      constexpr std::array<std::string_view, size_t(EUpdateBucket::MAX)> bucketNames{"Generic", "Patterned", "Effect",
+                                                                                     "Camera"};
+      const CEntityUpdateList& list = g_StateManager->GetUpdateList();
+      const SUpdateBucketStats& stats = g_StateManager->GetUpdateBucketStats();
+      for (size_t i = 0; i < bucketNames.size(); ++i) {
+        ImGuiStringViewText(fmt::format(FMT_STRING("{}: {} live, {} pre-thinks ({:.1f} us), {} thinks ({:.1f} us)\n"),
+                                        bucketNames[i], list.GetBucketCount(EUpdateBucket(i)), stats.preThinks[i],
+                                        stats.preThinkNanos[i] / 1000.0, stats.thinks[i],
+                                        stats.thinkNanos[i] / 1000.0));
+      }
+      ImGuiStringViewText(fmt::format(FMT_STRING("Occluded or paused AI skipped: {}\n"), stats.skippedAi));
+    }
     if (m_resourceStats && g_SimplePool != nullptr) {
       if (hasPrevious) {
         ImGui::Separator();
@@ -973,6 +992,23 @@ void ImGuiConsole::ShowDebugOverlay() {
       hasPrevious = true;
 
       ImGuiStringViewText(fmt::format(FMT_STRING("Resource Objects: {}\n"), g_SimplePool->GetLiveObjects()));
+      if (m_developer) {
+        if (const CResLoader* loader = g_ResFactory->GetResLoader()) {
+          const SResLookupStats& stats = loader->GetLastFrameLookupStats();
+          ImGuiStringViewText(fmt::format(FMT_STRING("Asset index: {} ids, lookups: {} (cached: {}, missed: {})\n"),
+                                          loader->GetResourceIndexSize(), stats.lookups, stats.cacheHits,
+                                          stats.misses));
+        }
+        constexpr std::array<std::string_view, kNumDvdPriorities> prioNames{"Stream", "Foreground", "Prefetch",
+                                                                            "Background"};
+        for (size_t i = 0; i < kNumDvdPriorities; ++i) {
+          const SDvdQueueStats stats = CDvdFile::GetQueueStats(EDvdPriority(i));
+          ImGuiStringViewText(
+              fmt::format(FMT_STRING("DVD {:<10} queued: {:3} avg: {:6.1f}ms max: {:6.1f}ms done: {} coalesced: {}\n"),
+                          prioNames[i], stats.queueDepth, stats.avgLatencyMs, stats.maxLatencyMs,
+                          stats.completedCount, stats.coalescedCount));
+        }
+      }
     }
     if (m_pipelineInfo && m_developer) {
       if (hasPrevious) {
@@ -1262,6 +1298,7 @@ void ImGuiConsole::ShowAppMainMenuBar(bool canInspect, bool preLaunch) {
         ImGui::MenuItem("Inspect", nullptr, &m_showInspectWindow, canInspect);
         ImGui::MenuItem("Layers", nullptr, &m_showLayersWindow, canInspect);
         ImGui::MenuItem("Player Transform", nullptr, &m_showPlayerTransformEditor, canInspect && m_cheats);
+        ImGui::MenuItem("Resource Costs", nullptr, &m_showResourceCostsWindow, g_ResFactory != nullptr);
       }
       ImGui::EndMenu();
     }
@@ -1275,6 +1312,7 @@ void ImGuiConsole::ShowAppMainMenuBar(bool canInspect, bool preLaunch) {
       ImGuiCVarMenuItem("Area Info", m_cvarCommons.m_debugOverlayAreaInfo, m_areaInfo);
       ImGuiCVarMenuItem("Layer Info", m_cvarCommons.m_debugOverlayLayerInfo, m_layerInfo);
       ImGuiCVarMenuItem("Random Stats", m_cvarCommons.m_debugOverlayShowRandomStats, m_randomStats);
+      ImGuiCVarMenuItem("Update Bucket Stats", m_cvarCommons.m_debugOverlayShowUpdateBucketStats, m_updateBucketStats);
       ImGuiCVarMenuItem("Draw Call Info", m_cvarCommons.m_debugOverlayDrawCallInfo, m_drawCallInfo);
       ImGuiCVarMenuItem("Pipeline Info", m_cvarCommons.m_debugOverlayPipelineInfo, m_pipelineInfo);
       ImGuiCVarMenuItem("Buffer Info", m_cvarCommons.m_debugOverlayBufferInfo, m_bufferInfo);
@@ -1331,6 +1369,8 @@ void ImGuiConsole::PreUpdate() {
     m_cvarCommons.m_debugOverlayAreaInfo->addListener([this](CVar* c) { m_areaInfo = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayLayerInfo->addListener([this](CVar* c) { m_layerInfo = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayShowRandomStats->addListener([this](CVar* c) { m_randomStats = c->toBoolean(); });
+    m_cvarCommons.m_debugOverlayShowUpdateBucketStats->addListener(
+        [this](CVar* c) { m_updateBucketStats = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayShowResourceStats->addListener([this](CVar* c) { m_resourceStats = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayShowInput->addListener([this](CVar* c) { m_showInput = c->toBoolean(); });
     m_cvarCommons.m_debugToolDrawAiPath->addListener([this](CVar* c) { m_drawAiPath = c->toBoolean(); });
@@ -1396,6 +1436,9 @@ void ImGuiConsole::PreUpdate() {
   if (canInspect && m_showLayersWindow) {
     ShowLayersWindow();
   }
+  if (m_showResourceCostsWindow && g_ResFactory != nullptr) {
+    ShowResourceCostsWindow();
+  }
   if (preLaunch || m_showAboutWindow) {
     ShowAboutWindow(preLaunch);
   }
@@ -1734,6 +1777,54 @@ void ImGuiConsole::ShowLayersWindow() {
   ImGui::End();
 }
 
+void ImGuiConsole::ShowResourceCostsWindow() {
+  float initialWindowSize = 400.f * GetScale();
+  ImGui::SetNextWindowSize(ImVec2{initialWindowSize, initialWindowSize}, ImGuiCond_FirstUseEver);
+
+  if (ImGui::Begin("Resource Costs", &m_showResourceCostsWindow)) {
+    const ResourceCostTable* table = g_ResFactory->GetResourceCostTable();
+    if (table == nullptr || table->empty()) {
+      ImGui::TextUnformatted("No resources built asynchronously yet");
+    } else if (ImGui::BeginTable("Resource Costs", 6,
+                                 ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter |
+                                     ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY)) {
+      ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Count", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Avg KB", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Async ms", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Finalize ms", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Max ms", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupScrollFreeze(0, 1);
+      ImGui::TableHeadersRow();
+
+      // Most expensive main-thread work first
+      std::vector<std::pair<FourCC, SResourceCost>> rows(table->begin(), table->end());
+      std::sort(rows.begin(), rows.end(),
+                [](const auto& a, const auto& b) { return a.second.finalizeTime > b.second.finalizeTime; });
+      const auto toMs = [](std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::milli>(ns).count();
+      };
+      for (const auto& [type, cost] : rows) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGuiStringViewText(fmt::format(FMT_STRING("{}"), type));
+        ImGui::TableNextColumn();
+        ImGuiStringViewText(fmt::format(FMT_STRING("{}"), cost.count));
+        ImGui::TableNextColumn();
+        ImGuiStringViewText(fmt::format(FMT_STRING("{:.1f}"), double(cost.bytes) / cost.count / 1024.0));
+        ImGui::TableNextColumn();
+        ImGuiStringViewText(fmt::format(FMT_STRING("{:.3f}"), toMs(cost.asyncTime) / cost.count));
+        ImGui::TableNextColumn();
+        ImGuiStringViewText(fmt::format(FMT_STRING("{:.3f}"), toMs(cost.finalizeTime) / cost.count));
+        ImGui::TableNextColumn();
+        ImGuiStringViewText(fmt::format(FMT_STRING("{:.3f}"), toMs(cost.maxFinalizeTime)));
+      }
+      ImGui::EndTable();
+    }
+  }
+  ImGui::End();
+}
+
 void ImGuiConsole::ShowToasts() {
   if (m_toasts.empty()) {
     return;
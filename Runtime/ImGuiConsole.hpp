@@ -80,6 +80,7 @@ private:
   bool m_showConsoleVariablesWindow = false;
   bool m_showPlayerTransformEditor = false;
   bool m_showPreLaunchSettingsWindow = false;
+  bool m_showResourceCostsWindow = false;
   std::optional<zeus::CVector3f> m_savedLocation;
   std::optional<zeus::CEulerAngles> m_savedRotation;
 
@@ -109,6 +110,7 @@ private:
   bool m_areaInfo = m_cvarCommons.m_debugOverlayAreaInfo->toBoolean();
   bool m_layerInfo = m_cvarCommons.m_debugOverlayLayerInfo->toBoolean();
   bool m_randomStats = m_cvarCommons.m_debugOverlayShowRandomStats->toBoolean();
+  bool m_updateBucketStats = m_cvarCommons.m_debugOverlayShowUpdateBucketStats->toBoolean();
   bool m_resourceStats = m_cvarCommons.m_debugOverlayShowResourceStats->toBoolean();
   bool m_showInput = m_cvarCommons.m_debugOverlayShowInput->toBoolean();
   bool m_drawAiPath = m_cvarCommons.m_debugToolDrawAiPath->toBoolean();
@@ -152,6 +154,7 @@ private:
   void ShowDebugOverlay();
   void ShowItemsWindow();
   void ShowLayersWindow();
+  void ShowResourceCostsWindow();
   void ShowConsoleVariablesWindow();
   void ShowToasts();
   void ShowInputViewer();
@@ -319,7 +319,8 @@ void CEntity::ImGuiInspect() {
       ImGui::EndTable();
     }
   }
-  if (m_incomingConnections != nullptr && ImGui::CollapsingHeader("Incoming Connections")) {
+  const std::span<const SConnection> incomingConnections = g_StateManager->GetIncomingConnections(xc_editorId);
+  if (!incomingConnections.empty() && ImGui::CollapsingHeader("Incoming Connections")) {
     if (ImGui::BeginTable("Incoming Connections", 6,
                           ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV)) {
       ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed, 0, 'id');
@@ -331,7 +332,7 @@ void CEntity::ImGuiInspect() {
                                       ImGuiTableColumnFlags_NoResize);
       ImGui::TableSetupScrollFreeze(0, 1);
       ImGui::TableHeadersRow();
-      for (const auto& item : *m_incomingConnections) {
+      for (const auto& item : incomingConnections) {
         const auto search = g_StateManager->GetIdListForScript(item.x8_objId);
         for (auto it = search.first; it != search.second; ++it) {
           auto uid = it->second;
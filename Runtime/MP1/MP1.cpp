@@ -278,6 +278,15 @@ void CGameGlobalObjects::AddPaksAndFactories() {
     fmgr->AddFactory(FOURCC('AFSM'), FFactoryFunc(FAiFiniteStateMachineFactory));
     fmgr->AddFactory(FOURCC('PATH'), FMemFactoryFunc(FPathFindAreaFactory));
     fmgr->AddFactory(FOURCC('TMET'), FFactoryFunc(FTextureCacheFactory));
+
+    /* Pure data parsers, safe to build on CJobPool workers */
+    fmgr->SetFactoryThreadSafe(FOURCC('CINF'));
+    fmgr->SetFactoryThreadSafe(FOURCC('DGRP'));
+    fmgr->SetFactoryThreadSafe(FOURCC('ATBL'));
+    fmgr->SetFactoryThreadSafe(FOURCC('STRG'));
+    fmgr->SetFactoryThreadSafe(FOURCC('HINT'));
+    fmgr->SetFactoryThreadSafe(FOURCC('SAVW'));
+    fmgr->SetFactoryThreadSafe(FOURCC('PATH'));
   }
 }
 
@@ -650,6 +659,9 @@ std::string CMain::Init(int argc, char** argv, const FileStoreManager& storeMgr,
 
 bool CMain::Proc(float dt) {
   CRandom16::ResetNumNextCalls();
+  if (CResLoader* loader = g_ResFactory->GetResLoader()) {
+    loader->EndFrameLookupStats();
+  }
   if (!m_loadedPersistentResources) {
     x128_globalObjects->m_gameResFactory->LoadPersistentResources(*g_SimplePool);
     m_loadedPersistentResources = true;
@@ -35,6 +35,9 @@ public:
               std::unique_ptr<CRealElement>&& d)
   : x4_r(std::move(a)), x8_g(std::move(b)), xc_b(std::move(c)), x10_a(std::move(d)) {}
   bool GetValue(int frame, zeus::CColor& colorOut) const override;
+  bool IsConstant() const override {
+    return x4_r->IsConstant() && x8_g->IsConstant() && xc_b->IsConstant() && x10_a->IsConstant();
+  }
 };
 
 class CCEFastConstant : public CColorElement {
@@ -43,6 +46,7 @@ class CCEFastConstant : public CColorElement {
 public:
   CCEFastConstant(float a, float b, float c, float d) : x4_val(a, b, c, d) {}
   bool GetValue(int frame, zeus::CColor& colorOut) const override;
+  bool IsConstant() const override { return true; }
 };
 
 class CCETimeChain : public CColorElement {
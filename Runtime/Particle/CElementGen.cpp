@@ -30,11 +30,11 @@ logvisor::Module Log("metaforce::CElementGen");
 u16 CElementGen::g_GlobalSeed = 99;
 bool CElementGen::g_subtractBlend = false;
 
-int CElementGen::g_ParticleAliveCount;
+std::atomic<int> CElementGen::g_ParticleAliveCount;
 int CElementGen::g_ParticleSystemAliveCount;
 bool CElementGen::g_ParticleSystemInitialized = false;
 bool CElementGen::sMoveRedToAlphaBuffer = false;
-CParticle* CElementGen::g_currentParticle = nullptr;
+thread_local CParticle* CElementGen::g_currentParticle = nullptr;
 
 // std::vector<SParticleInstanceTex> g_instTexData;
 // std::vector<SParticleInstanceIndTex> g_instIndTexData;
@@ -54,6 +54,10 @@ void CElementGen::Initialize() {
 
 void CElementGen::Shutdown() { CElementGenShaders::Shutdown(); }
 
+bool CElementGen::HasParticleHeadroom(u32 growth) {
+  return s64(g_ParticleAliveCount) + s64(growth) <= MAX_GLOBAL_PARTICLES;
+}
+
 CElementGen::CElementGen(TToken<CGenDescription> gen, EModelOrientationType orientType, EOptionalSystemFlags flags)
 : x1c_genDesc(std::move(gen))
 , x2c_orientType(orientType)
@@ -230,7 +234,7 @@ CElementGen::CElementGen(TToken<CGenDescription> gen, EModelOrientationType orie
 
 CElementGen::~CElementGen() {
   --g_ParticleSystemAliveCount;
-  g_ParticleAliveCount -= x30_particles.size();
+  g_ParticleAliveCount -= int(x30_particles.size());
 }
 
 bool CElementGen::Update(double t) {
@@ -420,6 +424,29 @@ bool CElementGen::UpdateVelocitySource(size_t idx, s32 particleFrame, CParticle&
   return false;
 }
 
+void CElementGen::CullExpiredParticles() {
+  /* Expired particles are replaced by the last one, keeping the original draw order semantics */
+  for (size_t i = 0; i < x30_particles.size();) {
+    if (x30_particles[i].x0_endFrame >= x74_curFrame) {
+      ++i;
+      continue;
+    }
+
+    --g_ParticleAliveCount;
+    const size_t last = x30_particles.size() - 1;
+    if (i != last) {
+      x30_particles[i] = x30_particles[last];
+
+      if (x2c_orientType == EModelOrientationType::One)
+        x50_parentMatrices[i] = x50_parentMatrices[last];
+
+      if (x26d_28_enableADV)
+        x60_advValues[i] = x60_advValues[last];
+    }
+    x30_particles.pop_back();
+  }
+}
+
 void CElementGen::UpdateExistingParticles() {
   CGenDescription* desc = x1c_genDesc.GetObj();
 
@@ -427,68 +454,115 @@ void CElementGen::UpdateExistingParticles() {
   CParticleGlobals::instance()->SetEmitterTime(x74_curFrame);
   CParticleGlobals::instance()->m_particleAccessParameters = nullptr;
 
-  for (auto it = x30_particles.begin(); it != x30_particles.end();) {
-    CParticle& particle = *it;
-
-    if (particle.x0_endFrame < x74_curFrame) {
-      --g_ParticleAliveCount;
-      if (it + 1 == x30_particles.end()) {
-        x30_particles.pop_back();
-        break;
-      } else {
-        particle = x30_particles.back();
-
-        if (x2c_orientType == EModelOrientationType::One)
-          x50_parentMatrices[x25c_activeParticleCount] = x50_parentMatrices[x30_particles.size() - 1];
-
-        if (x26d_28_enableADV)
-          x60_advValues[x25c_activeParticleCount] = x60_advValues[x30_particles.size() - 1];
-
-        x30_particles.pop_back();
-        if (particle.x0_endFrame < x74_curFrame)
-          continue;
-      }
-    }
+  CullExpiredParticles();
+  x25c_activeParticleCount = x30_particles.size();
 
+  /* Integrate in one tight pass; elements only ever see the particle they are evaluated for,
+   * so this is equivalent to stepping each particle right before its elements run. */
+  for (CParticle& particle : x30_particles) {
     particle.x10_prevPos = particle.x4_pos;
     particle.x4_pos += particle.x1c_vel;
+  }
 
-    g_currentParticle = &particle;
+  /* Constant elements can't change after CreateNewParticles wrote them (existing particles are
+   * always past frame 0 here), so only per-frame elements are evaluated per particle. */
+  const auto perFrame = [](auto* elem) { return elem != nullptr && !elem->IsConstant() ? elem : nullptr; };
+  CRealElement* sizeElem = perFrame(x26c_31_LINE ? desc->x20_x14_LENG.get() : desc->x4c_x38_SIZE.get());
+  CRealElement* rotaElem = perFrame(x26c_31_LINE ? desc->x24_x18_WIDT.get() : desc->x50_x3c_ROTA.get());
+  CColorElement* colrElem = perFrame(desc->x30_x24_COLR.get());
+  const bool hasVelSources = x280_VELSources[0] != nullptr;
+
+  /* Size and rotation run as batch programs when every per-frame element among them was lowered.
+   * Lowered programs never draw randoms, but colour has to move after them and would then draw after
+   * every particle's ADV and VEL elements instead of interleaved with them, so that case stays scalar. */
+  const CElementProgram* sizeProgram = nullptr;
+  const CElementProgram* rotaProgram = nullptr;
+  if (sizeElem != nullptr) {
+    sizeProgram = x26c_31_LINE ? desc->m_lengProgram.get() : desc->m_sizeProgram.get();
+  }
+  if (rotaElem != nullptr) {
+    rotaProgram = x26c_31_LINE ? desc->m_widtProgram.get() : desc->m_rotaProgram.get();
+  }
+  const bool batchElements = (sizeElem != nullptr || rotaElem != nullptr) && (sizeElem == nullptr || sizeProgram) &&
+                             (rotaElem == nullptr || rotaProgram) &&
+                             (colrElem == nullptr || (!x26d_28_enableADV && !hasVelSources));
+  if (batchElements) {
+    sizeElem = nullptr;
+    rotaElem = nullptr;
+  }
 
+  const auto beginParticle = [&](size_t i) {
+    CParticle& particle = x30_particles[i];
+    g_currentParticle = &particle;
     CParticleGlobals::instance()->SetParticleLifetime(particle.x0_endFrame - particle.x28_startFrame);
     const int particleFrame = x74_curFrame - particle.x28_startFrame;
     CParticleGlobals::instance()->UpdateParticleLifetimeTweenValues(particleFrame);
+    return particleFrame;
+  };
 
-    if (x26d_28_enableADV) {
-      UpdateAdvanceAccessParameters(x25c_activeParticleCount, particleFrame);
-    }
+  /* With batch programs, colour moves after them so it still observes this frame's size and rotation */
+  CColorElement* scalarColrElem = batchElements ? nullptr : colrElem;
+  if (x26d_28_enableADV || hasVelSources || sizeElem != nullptr || rotaElem != nullptr || scalarColrElem != nullptr) {
+    for (size_t i = 0; i < x30_particles.size(); ++i) {
+      CParticle& particle = x30_particles[i];
+      const int particleFrame = beginParticle(i);
 
-    ++x25c_activeParticleCount;
+      if (x26d_28_enableADV) {
+        UpdateAdvanceAccessParameters(i, particleFrame);
+      }
 
-    for (size_t i = 0; i < x280_VELSources.size(); ++i) {
-      if (!x280_VELSources[i]) {
-        break;
+      for (size_t v = 0; v < x280_VELSources.size(); ++v) {
+        if (!x280_VELSources[v]) {
+          break;
+        }
+        UpdateVelocitySource(v, particleFrame, particle);
+      }
+
+      // Evaluation order matches CreateNewParticles so random draws stay in sequence
+      if (x26c_31_LINE) {
+        if (sizeElem != nullptr)
+          sizeElem->GetValue(particleFrame, particle.x2c_lineLengthOrSize);
+        if (rotaElem != nullptr)
+          rotaElem->GetValue(particleFrame, particle.x30_lineWidthOrRota);
+      } else {
+        if (rotaElem != nullptr)
+          rotaElem->GetValue(particleFrame, particle.x30_lineWidthOrRota);
+        if (sizeElem != nullptr)
+          sizeElem->GetValue(particleFrame, particle.x2c_lineLengthOrSize);
       }
-      UpdateVelocitySource(i, particleFrame, particle);
+
+      if (scalarColrElem != nullptr)
+        scalarColrElem->GetValue(particleFrame, particle.x34_color);
     }
+  }
 
+  if (batchElements) {
+    const std::array<float, 8>* advValues = x26d_28_enableADV ? x60_advValues.data() : nullptr;
+    const auto runProgram = [&](const CElementProgram* program, float CParticle::*dst) {
+      if (program != nullptr) {
+        program->Run(x30_particles.data(), x30_particles.size(), advValues, x74_curFrame, x74_curFrame, dst);
+      }
+    };
     if (x26c_31_LINE) {
-      if (CRealElement* leng = desc->x20_x14_LENG.get())
-        leng->GetValue(particleFrame, particle.x2c_lineLengthOrSize);
-      if (CRealElement* widt = desc->x24_x18_WIDT.get())
-        widt->GetValue(particleFrame, particle.x30_lineWidthOrRota);
+      runProgram(sizeProgram, &CParticle::x2c_lineLengthOrSize);
+      runProgram(rotaProgram, &CParticle::x30_lineWidthOrRota);
     } else {
-      if (CRealElement* rota = desc->x50_x3c_ROTA.get())
-        rota->GetValue(particleFrame, particle.x30_lineWidthOrRota);
-      if (CRealElement* size = desc->x4c_x38_SIZE.get())
-        size->GetValue(particleFrame, particle.x2c_lineLengthOrSize);
+      runProgram(rotaProgram, &CParticle::x30_lineWidthOrRota);
+      runProgram(sizeProgram, &CParticle::x2c_lineLengthOrSize);
     }
 
-    if (CColorElement* colr = desc->x30_x24_COLR.get())
-      colr->GetValue(particleFrame, particle.x34_color);
+    if (colrElem != nullptr) {
+      for (size_t i = 0; i < x30_particles.size(); ++i) {
+        const int particleFrame = beginParticle(i);
+        CParticleGlobals::instance()->m_particleAccessParameters =
+            x26d_28_enableADV ? &x60_advValues[i] : nullptr;
+        colrElem->GetValue(particleFrame, x30_particles[i].x34_color);
+      }
+    }
+  }
 
+  for (const CParticle& particle : x30_particles) {
     AccumulateBounds(particle.x4_pos, particle.x2c_lineLengthOrSize);
-    ++it;
   }
 
   if (x30_particles.empty())
@@ -514,8 +588,9 @@ void CElementGen::CreateNewParticles(int count) {
     count = x90_MAXP - x30_particles.size();
   }
 
-  if (g_ParticleAliveCount + count > 2560) {
-    count = 2560 - g_ParticleAliveCount;
+  const int aliveCount = g_ParticleAliveCount;
+  if (aliveCount + count > MAX_GLOBAL_PARTICLES) {
+    count = MAX_GLOBAL_PARTICLES - aliveCount;
   }
 
   CGlobalRandom gr(x27c_randState);
@@ -1906,6 +1981,25 @@ std::optional<zeus::CAABox> CElementGen::GetBounds() const {
 
 u32 CElementGen::GetParticleCount() const { return x25c_activeParticleCount; }
 
+const void* CElementGen::GetConcurrentUpdateGroup() const {
+  /* Child systems are constructed (and KSSM reseeds g_GlobalSeed) mid-update, and warps ray cast
+   * against the world, so only plain emitters may run off the main thread. Sample-and-hold elements
+   * keep state in the description, which makes it the group key. */
+  const CGenDescription* desc = x28_loadedGenDesc;
+  if (!g_ParticleSystemInitialized || !x4_modifierList.empty() || !x290_activePartChildren.empty() ||
+      desc->x8c_x78_ICTS || desc->xa4_x90_IDTS || desc->xb8_xa4_IITS || desc->xd0_xbc_KSSM ||
+      desc->xd4_xc0_SSWH || desc->xec_xd8_SELC) {
+    return nullptr;
+  }
+  return desc;
+}
+
+u32 CElementGen::GetMaxParticleGrowth() const {
+  const CIntElement* maxpElem = x28_loadedGenDesc->x28_x1c_MAXP.get();
+  const int maxParticles = maxpElem != nullptr ? maxpElem->GetMaxValue() : x90_MAXP;
+  return u32(std::max(0, maxParticles - int(x30_particles.size())));
+}
+
 bool CElementGen::SystemHasLight() const { return x308_lightType != LightType::None; }
 
 CLight CElementGen::GetLight() const {
@@ -1926,7 +2020,7 @@ CLight CElementGen::GetLight() const {
 bool CElementGen::GetParticleEmission() const { return x88_particleEmission; }
 
 void CElementGen::DestroyParticles() {
-  g_ParticleAliveCount -= x30_particles.size();
+  g_ParticleAliveCount -= int(x30_particles.size());
   x30_particles.clear();
   x50_parentMatrices.clear();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <vector>
 
 #include "Runtime/CRandom16.hpp"
@@ -45,13 +46,15 @@ public:
   public:
     explicit CParticleListItem(s16 idx) : x0_partIdx(idx) {}
   };
-  static CParticle* g_currentParticle;
+  static thread_local CParticle* g_currentParticle;
 
 private:
   friend class CElementGenShaders;
   TLockedToken<CGenDescription> x1c_genDesc;
   CGenDescription* x28_loadedGenDesc;
   EModelOrientationType x2c_orientType;
+  /* Kept as whole records: particle-access elements, CWarp and the renderers all read through
+   * g_currentParticle. UpdateExistingParticles batches work as separate passes over it instead. */
   std::vector<CParticle> x30_particles;
   std::vector<u32> x40;
   std::vector<zeus::CMatrix3f> x50_parentMatrices;
@@ -158,14 +161,17 @@ public:
   CGenDescription* GetLoadedDesc() { return x28_loadedGenDesc; }
 
   static bool g_ParticleSystemInitialized;
-  static int g_ParticleAliveCount;
+  static std::atomic<int> g_ParticleAliveCount;
   static int g_ParticleSystemAliveCount;
   static bool sMoveRedToAlphaBuffer;
+  /* True if growth more particles would fit under the global particle cap */
+  static bool HasParticleHeadroom(u32 growth);
   static void Initialize();
   static void Shutdown();
 
   void UpdateAdvanceAccessParameters(u32 activeParticleCount, s32 particleFrame);
   bool UpdateVelocitySource(size_t idx, s32 particleFrame, CParticle& particle);
+  void CullExpiredParticles();
   void UpdateExistingParticles();
   void CreateNewParticles(int count);
   void UpdatePSTranslationAndOrientation();
@@ -217,6 +223,8 @@ public:
   void DestroyParticles() override;
   void Reset() override;
   FourCC Get4CharId() const override { return FOURCC('PART'); }
+  const void* GetConcurrentUpdateGroup() const override;
+  u32 GetMaxParticleGrowth() const override;
   size_t GetNumActiveChildParticles() const { return x290_activePartChildren.size(); }
   CParticleGen& GetActiveChildParticle(size_t idx) const { return *x290_activePartChildren[idx]; }
   bool IsIndirectTextured() const { return x28_loadedGenDesc->x54_x40_TEXR && x28_loadedGenDesc->x58_x44_TIND; }
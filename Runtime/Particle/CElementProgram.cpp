@@ -0,0 +1,229 @@
+#include "Runtime/Particle/CElementProgram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Runtime/Particle/CParticleGen.hpp"
+#include "Runtime/Particle/IElement.hpp"
+
+#include <zeus/Math.hpp>
+
+namespace metaforce {
+namespace {
+bool IsPure(CElementProgram::EOp op) {
+  switch (op) {
+  case CElementProgram::EOp::Add:
+  case CElementProgram::EOp::Subtract:
+  case CElementProgram::EOp::Multiply:
+  case CElementProgram::EOp::Clamp:
+  case CElementProgram::EOp::CompareLessThan:
+  case CElementProgram::EOp::CompareEquals:
+    return true;
+  default:
+    return false;
+  }
+}
+
+size_t OperandCount(CElementProgram::EOp op) {
+  switch (op) {
+  case CElementProgram::EOp::TimeScale:
+  case CElementProgram::EOp::LifetimePercent:
+    return 1;
+  case CElementProgram::EOp::Add:
+  case CElementProgram::EOp::Subtract:
+  case CElementProgram::EOp::Multiply:
+  case CElementProgram::EOp::LifetimeTween:
+    return 2;
+  case CElementProgram::EOp::Clamp:
+  case CElementProgram::EOp::SineWave:
+    return 3;
+  case CElementProgram::EOp::CompareLessThan:
+  case CElementProgram::EOp::CompareEquals:
+    return 4;
+  default:
+    return 0;
+  }
+}
+
+/* Shared by the interpreter and constant folding so both produce identical results */
+float EvalPure(CElementProgram::EOp op, float a, float b, float c, float d) {
+  switch (op) {
+  case CElementProgram::EOp::Add:
+    return a + b;
+  case CElementProgram::EOp::Subtract:
+    return a - b;
+  case CElementProgram::EOp::Multiply:
+    return a * b;
+  case CElementProgram::EOp::Clamp: {
+    float val = c;
+    if (val > b)
+      val = b;
+    if (val < a)
+      val = a;
+    return val;
+  }
+  case CElementProgram::EOp::CompareLessThan:
+    return a < b ? c : d;
+  case CElementProgram::EOp::CompareEquals:
+    return zeus::close_enough(a, b) ? c : d;
+  default:
+    return 0.f;
+  }
+}
+} // Anonymous namespace
+
+bool CElementProgram::Emit(EOp op, u8& regOut, float imm, u8 a, u8 b, u8 c, u8 d) {
+  const std::array<u8, 4> args{a, b, c, d};
+  const size_t operandCount = OperandCount(op);
+
+  if (IsPure(op) && std::all_of(args.begin(), args.begin() + operandCount, [&](u8 reg) { return IsConstant(reg); })) {
+    /* Operand subtrees are emitted immediately before their user, so folded constants sit at the tail */
+    const float value =
+        EvalPure(op, m_code[a].imm, m_code[b].imm, operandCount > 2 ? m_code[c].imm : 0.f,
+                 operandCount > 3 ? m_code[d].imm : 0.f);
+    m_code.resize(*std::min_element(args.begin(), args.begin() + operandCount));
+    op = EOp::Constant;
+    imm = value;
+  }
+
+  if (m_code.size() >= kMaxInstructions) {
+    m_overflowed = true;
+    return false;
+  }
+  regOut = u8(m_code.size());
+  m_code.push_back(SInstruction{op, op == EOp::Constant ? std::array<u8, 4>{} : args, imm});
+  return true;
+}
+
+bool CElementProgram::EmitKeyframes(SKeyframes&& keyframes, bool lifetimePercent, u8& regOut) {
+  if (keyframes.keys.empty() || (lifetimePercent && keyframes.keys.size() <= 100)) {
+    return false;
+  }
+  const float idx = float(m_keyframes.size());
+  m_keyframes.push_back(std::move(keyframes));
+  return Emit(lifetimePercent ? EOp::KeyframeLifetime : EOp::KeyframeEmitter, regOut, idx);
+}
+
+std::unique_ptr<CElementProgram> CElementProgram::Compile(const CRealElement* elem) {
+  if (elem == nullptr || elem->IsConstant()) {
+    return nullptr;
+  }
+  auto ret = std::make_unique<CElementProgram>();
+  u8 result = 0;
+  if (!elem->Lower(*ret, result) || ret->m_overflowed || result + 1u != ret->m_code.size()) {
+    return nullptr;
+  }
+  return ret;
+}
+
+void CElementProgram::Run(CParticle* particles, size_t count, const std::array<float, 8>* advValues, s32 curFrame,
+                          s32 emitterTime, float CParticle::*dst) const {
+  std::array<std::array<float, kLaneCount>, kMaxInstructions> regs;
+  std::array<s32, kLaneCount> frames;
+  std::array<s32, kLaneCount> lifetimes;
+
+  for (size_t base = 0; base < count; base += kLaneCount) {
+    const size_t lanes = std::min(kLaneCount, count - base);
+    CParticle* const batch = particles + base;
+    for (size_t i = 0; i < lanes; ++i) {
+      frames[i] = curFrame - batch[i].x28_startFrame;
+      lifetimes[i] = batch[i].x0_endFrame - batch[i].x28_startFrame;
+    }
+
+    for (size_t pc = 0; pc < m_code.size(); ++pc) {
+      const SInstruction& inst = m_code[pc];
+      float* const out = regs[pc].data();
+      const float* const a = regs[inst.args[0]].data();
+      const float* const b = regs[inst.args[1]].data();
+      const float* const c = regs[inst.args[2]].data();
+      const float* const d = regs[inst.args[3]].data();
+
+      switch (inst.op) {
+      case EOp::Constant:
+        std::fill_n(out, lanes, inst.imm);
+        break;
+      case EOp::Add:
+      case EOp::Subtract:
+      case EOp::Multiply:
+      case EOp::Clamp:
+      case EOp::CompareLessThan:
+      case EOp::CompareEquals:
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = EvalPure(inst.op, a[i], b[i], c[i], d[i]);
+        }
+        break;
+      case EOp::TimeScale:
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = float(frames[i]) * a[i];
+        }
+        break;
+      case EOp::SineWave:
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = std::sin(zeus::degToRad(float(frames[i]) * a[i] + c[i])) * b[i];
+        }
+        break;
+      case EOp::LifetimeTween:
+        for (size_t i = 0; i < lanes; ++i) {
+          const float ltFac = float(frames[i]) / float(lifetimes[i]);
+          out[i] = b[i] * ltFac + (1.0f - ltFac) * a[i];
+        }
+        break;
+      case EOp::LifetimePercent:
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = (std::max(0.0f, a[i]) / 100.0f) * float(lifetimes[i]);
+        }
+        break;
+      case EOp::AccessParam: {
+        const size_t param = size_t(inst.imm);
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = advValues != nullptr ? advValues[base + i][param] : 0.f;
+        }
+        break;
+      }
+      case EOp::ParticleSize:
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = batch[i].x2c_lineLengthOrSize;
+        }
+        break;
+      case EOp::ParticleRotation:
+        for (size_t i = 0; i < lanes; ++i) {
+          out[i] = batch[i].x30_lineWidthOrRota;
+        }
+        break;
+      case EOp::KeyframeEmitter: {
+        /* Only depends on emitter time, so every lane gets the same key */
+        const SKeyframes& kf = m_keyframes[size_t(inst.imm)];
+        s32 calcKey = emitterTime;
+        if (kf.loop) {
+          if (emitterTime >= kf.loopEnd) {
+            calcKey = (emitterTime - kf.loopStart) % (kf.loopEnd - kf.loopStart) + kf.loopStart;
+          }
+        } else if (kf.loopEnd - 1 < emitterTime) {
+          calcKey = kf.loopEnd - 1;
+        }
+        std::fill_n(out, lanes, kf.keys[calcKey]);
+        break;
+      }
+      case EOp::KeyframeLifetime: {
+        const SKeyframes& kf = m_keyframes[size_t(inst.imm)];
+        for (size_t i = 0; i < lanes; ++i) {
+          const float lt = lifetimes[i] != 0 ? float(lifetimes[i]) : 1.0f;
+          const float percReal = 100.0f * float(frames[i]) / lt;
+          const s32 perc = s32(percReal);
+          const float rem = percReal - float(perc);
+          const s32 clamped = zeus::clamp(0, perc, 100);
+          out[i] = clamped == 100 ? kf.keys[100] : rem * kf.keys[clamped + 1] + (1.0f - rem) * kf.keys[clamped];
+        }
+        break;
+      }
+      }
+    }
+
+    const float* const result = regs[m_code.size() - 1].data();
+    for (size_t i = 0; i < lanes; ++i) {
+      batch[i].*dst = result[i];
+    }
+  }
+}
+
+} // namespace metaforce
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "Runtime/GCNTypes.hpp"
+
+namespace metaforce {
+class CRealElement;
+struct CParticle;
+
+/* Per-particle CRealElement tree lowered into a linear register program.
+ * Each instruction writes its own register, operands always precede their users,
+ * and subtrees whose inputs are all constant are folded while lowering.
+ * Run() evaluates a whole range of particles one instruction at a time, so the
+ * inner loops have no virtual dispatch and no dependence on CParticleGlobals. */
+class CElementProgram {
+public:
+  enum class EOp : u8 {
+    Constant,
+    Add,
+    Subtract,
+    Multiply,
+    Clamp,
+    CompareLessThan,
+    CompareEquals,
+    TimeScale,
+    SineWave,
+    LifetimeTween,
+    LifetimePercent,
+    AccessParam,
+    ParticleSize,
+    ParticleRotation,
+    KeyframeEmitter,
+    KeyframeLifetime,
+  };
+
+  struct SInstruction {
+    EOp op;
+    std::array<u8, 4> args{};
+    float imm = 0.f;
+  };
+
+  /* Mirrors CREKeyframeEmitter */
+  struct SKeyframes {
+    bool loop = false;
+    s32 loopEnd = 0;
+    s32 loopStart = 0;
+    std::vector<float> keys;
+  };
+
+  static constexpr size_t kMaxInstructions = 32;
+  static constexpr size_t kLaneCount = 64;
+
+private:
+  std::vector<SInstruction> m_code;
+  std::vector<SKeyframes> m_keyframes;
+  bool m_overflowed = false;
+
+  bool IsConstant(u8 reg) const { return m_code[reg].op == EOp::Constant; }
+
+public:
+  /* Lowering interface used by CRealElement::Lower; returns false when the program is full */
+  bool Emit(EOp op, u8& regOut, float imm = 0.f, u8 a = 0, u8 b = 0, u8 c = 0, u8 d = 0);
+  bool EmitKeyframes(SKeyframes&& keyframes, bool lifetimePercent, u8& regOut);
+
+  /* Returns nullptr if any node in the tree can't be lowered */
+  static std::unique_ptr<CElementProgram> Compile(const CRealElement* elem);
+
+  size_t GetInstructionCount() const { return m_code.size(); }
+
+  /* Evaluates for particles [0, count) and stores the result in each particle's dst field.
+   * advValues parallels particles and may be null when the generator has no ADV elements. */
+  void Run(CParticle* particles, size_t count, const std::array<float, 8>* advValues, s32 curFrame,
+           s32 emitterTime, float CParticle::*dst) const;
+};
+
+} // namespace metaforce
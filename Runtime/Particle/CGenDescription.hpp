@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "Runtime/Particle/CColorElement.hpp"
+#include "Runtime/Particle/CElementProgram.hpp"
 #include "Runtime/Particle/CEmitterElement.hpp"
 #include "Runtime/Particle/CIntElement.hpp"
 #include "Runtime/Particle/CModVectorElement.hpp"
@@ -107,6 +108,12 @@ public:
   /* Custom additions */
   std::unique_ptr<CColorElement> m_bevelGradient; /* FourCC BGCL */
 
+  /* Per-particle update elements lowered by CParticleDataFactory, null when not lowerable */
+  std::unique_ptr<CElementProgram> m_lengProgram;
+  std::unique_ptr<CElementProgram> m_widtProgram;
+  std::unique_ptr<CElementProgram> m_sizeProgram;
+  std::unique_ptr<CElementProgram> m_rotaProgram;
+
   CGenDescription() = default;
 };
 
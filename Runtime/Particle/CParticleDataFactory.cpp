@@ -743,6 +743,7 @@ std::unique_ptr<CGenDescription> CParticleDataFactory::CreateGeneratorDescriptio
       auto ret = std::make_unique<CGenDescription>();
       CreateGPSM(ret.get(), in, tracker, resPool);
       LoadGPSMTokens(ret.get());
+      LowerGPSMElements(ret.get());
       return ret;
     }
   }
@@ -1040,6 +1041,13 @@ void CParticleDataFactory::LoadGPSMTokens(CGenDescription* desc) {
   desc->xd4_xc0_SSWH.Load();
 }
 
+void CParticleDataFactory::LowerGPSMElements(CGenDescription* desc) {
+  desc->m_lengProgram = CElementProgram::Compile(desc->x20_x14_LENG.get());
+  desc->m_widtProgram = CElementProgram::Compile(desc->x24_x18_WIDT.get());
+  desc->m_sizeProgram = CElementProgram::Compile(desc->x4c_x38_SIZE.get());
+  desc->m_rotaProgram = CElementProgram::Compile(desc->x50_x3c_ROTA.get());
+}
+
 CFactoryFnReturn FParticleFactory(const SObjectTag& tag, CInputStream& in, const CVParamTransfer& vparms,
                                   CObjectReference* selfRef) {
   auto* const sp = vparms.GetOwnedObj<CSimplePool*>();
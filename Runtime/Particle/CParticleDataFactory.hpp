@@ -79,6 +79,7 @@ class CParticleDataFactory {
   static bool CreateGPSM(CGenDescription* fillDesc, CInputStream& in, std::vector<CAssetId>& tracker,
                          CSimplePool* resPool);
   static void LoadGPSMTokens(CGenDescription* desc);
+  static void LowerGPSMElements(CGenDescription* desc);
 
 public:
   static std::unique_ptr<CGenDescription> GetGeneratorDesc(CInputStream& in, CSimplePool* resPool);
@@ -1,7 +1,77 @@
 #include "Runtime/Particle/CParticleGen.hpp"
 
+#include <unordered_map>
+#include <vector>
+
+#include "Runtime/CJobPool.hpp"
+#include "Runtime/Particle/CElementGen.hpp"
+
+#include <optick.h>
+
 namespace metaforce {
+namespace {
+/* Below this many live particles the job hand-off costs more than the update itself */
+constexpr u32 kMinConcurrentParticles = 256;
+
+struct SUpdateBatch {
+  std::vector<std::vector<CParticleGen*>> groups;
+  std::unordered_map<const void*, size_t> groupIdx;
+  u32 growth = 0;
+  u32 particleCount = 0;
+
+  void Add(CParticleGen* gen, const void* key) {
+    auto [it, inserted] = groupIdx.try_emplace(key, groups.size());
+    if (inserted) {
+      groups.emplace_back();
+    }
+    groups[it->second].push_back(gen);
+    growth += gen->GetMaxParticleGrowth();
+    particleCount += gen->GetParticleCount();
+  }
+
+  /* gens is the same run in submission order, used when the batch has to stay serial */
+  void Flush(std::span<CParticleGen* const> gens, double dt) {
+    /* If the global particle cap could bind, the update order decides who gets particles */
+    if (groups.size() > 1 && particleCount >= kMinConcurrentParticles && CElementGen::HasParticleHeadroom(growth)) {
+      CJobPool::Shared().ParallelFor(groups.size(), 1, [&](size_t begin, size_t end) {
+        OPTICK_EVENT("CParticleGen::UpdateBatch job");
+        for (size_t i = begin; i < end; ++i) {
+          for (CParticleGen* gen : groups[i]) {
+            gen->Update(dt);
+          }
+        }
+      });
+    } else {
+      for (CParticleGen* gen : gens) {
+        gen->Update(dt);
+      }
+    }
+    groups.clear();
+    groupIdx.clear();
+    growth = 0;
+    particleCount = 0;
+  }
+};
+} // Anonymous namespace
 
 void CParticleGen::AddModifier(CWarp* mod) { x4_modifierList.push_back(mod); }
 
+void CParticleGen::UpdateBatch(std::span<CParticleGen* const> gens, double dt) {
+  OPTICK_EVENT();
+  SUpdateBatch batch;
+  size_t runStart = 0;
+  for (size_t i = 0; i < gens.size(); ++i) {
+    CParticleGen* gen = gens[i];
+    if (const void* key = gen->GetConcurrentUpdateGroup()) {
+      batch.Add(gen, key);
+      continue;
+    }
+    /* Generators that must stay on this thread also act as ordering barriers */
+    batch.Flush(gens.subspan(runStart, i - runStart), dt);
+    gen->Update(dt);
+    runStart = i + 1;
+  }
+  batch.Flush(gens.subspan(runStart), dt);
+}
+
 } // namespace metaforce
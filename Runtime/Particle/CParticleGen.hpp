@@ -2,6 +2,7 @@
 
 #include <list>
 #include <optional>
+#include <span>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/Graphics/CLight.hpp"
@@ -61,7 +62,17 @@ public:
   virtual void Reset() = 0;
   virtual FourCC Get4CharId() const = 0;
 
+  /* Non-null if Update touches no shared state other than what the returned key guards;
+   * generators with the same key are updated in order on one thread */
+  virtual const void* GetConcurrentUpdateGroup() const { return nullptr; }
+  /* Upper bound on how many particles one Update can add to CElementGen's global count */
+  virtual u32 GetMaxParticleGrowth() const { return 0; }
+
   virtual void AddModifier(CWarp* mod);
+
+  /* Same result as calling Update on each generator in order, but independent
+   * generators are spread across CJobPool::Shared() */
+  static void UpdateBatch(std::span<CParticleGen* const> gens, double dt);
 };
 
 } // namespace metaforce
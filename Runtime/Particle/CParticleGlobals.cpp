@@ -1,5 +1,5 @@
 #include "Runtime/Particle/CParticleGlobals.hpp"
 
 namespace metaforce {
-std::unique_ptr<CParticleGlobals> CParticleGlobals::g_ParticleGlobals;
+thread_local std::unique_ptr<CParticleGlobals> CParticleGlobals::g_ParticleGlobals;
 } // namespace metaforce
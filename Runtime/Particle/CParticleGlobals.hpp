@@ -14,7 +14,8 @@ namespace metaforce {
 class CElementGen;
 class CParticleGlobals {
   CParticleGlobals() = default;
-  static std::unique_ptr<CParticleGlobals> g_ParticleGlobals;
+  /* One per thread; this is the update context for whichever generator the thread is running */
+  static thread_local std::unique_ptr<CParticleGlobals> g_ParticleGlobals;
 
 public:
   int m_EmitterTime = 0;
@@ -3,6 +3,7 @@
 #include "Runtime/CRandom16.hpp"
 #include "Runtime/Graphics/CTexture.hpp"
 #include "Runtime/Particle/CElementGen.hpp"
+#include "Runtime/Particle/CElementProgram.hpp"
 #include "Runtime/Particle/CGenDescription.hpp"
 #include "Runtime/Particle/CParticleGlobals.hpp"
 
@@ -54,6 +55,10 @@ bool CREKeyframeEmitter::GetValue([[maybe_unused]] int frame, float& valOut) con
   return false;
 }
 
+bool CREKeyframeEmitter::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.EmitKeyframes({xc_loop, s32(x10_loopEnd), s32(x14_loopStart), x18_keys}, x4_percent != 0, regOut);
+}
+
 bool CRELifetimeTween::GetValue(int frame, float& valOut) const {
   float ltFac = frame / CParticleGlobals::instance()->m_ParticleLifetimeReal;
   float a, b;
@@ -63,11 +68,21 @@ bool CRELifetimeTween::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRELifetimeTween::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b;
+  return x4_a->Lower(prog, a) && x8_b->Lower(prog, b) &&
+         prog.Emit(CElementProgram::EOp::LifetimeTween, regOut, 0.f, a, b);
+}
+
 bool CREConstant::GetValue([[maybe_unused]] int frame, float& valOut) const {
   valOut = x4_val;
   return false;
 }
 
+bool CREConstant::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::Constant, regOut, x4_val);
+}
+
 bool CRETimeChain::GetValue(int frame, float& valOut) const {
   int v;
   xc_swFrame->GetValue(frame, v);
@@ -86,6 +101,11 @@ bool CREAdd::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CREAdd::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b;
+  return x4_a->Lower(prog, a) && x8_b->Lower(prog, b) && prog.Emit(CElementProgram::EOp::Add, regOut, 0.f, a, b);
+}
+
 bool CREClamp::GetValue(int frame, float& valOut) const {
   float a, b;
   x4_min->GetValue(frame, a);
@@ -98,6 +118,12 @@ bool CREClamp::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CREClamp::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 min, max, val;
+  return x4_min->Lower(prog, min) && x8_max->Lower(prog, max) && xc_val->Lower(prog, val) &&
+         prog.Emit(CElementProgram::EOp::Clamp, regOut, 0.f, min, max, val);
+}
+
 bool CREInitialRandom::GetValue(int frame, float& valOut) const {
   if (frame == 0) {
     float a, b;
@@ -134,6 +160,11 @@ bool CREMultiply::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CREMultiply::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b;
+  return x4_a->Lower(prog, a) && x8_b->Lower(prog, b) && prog.Emit(CElementProgram::EOp::Multiply, regOut, 0.f, a, b);
+}
+
 bool CREPulse::GetValue(int frame, float& valOut) const {
   int a, b;
   x4_aDuration->GetValue(frame, a);
@@ -160,6 +191,11 @@ bool CRETimeScale::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRETimeScale::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a;
+  return x4_a->Lower(prog, a) && prog.Emit(CElementProgram::EOp::TimeScale, regOut, 0.f, a);
+}
+
 bool CRELifetimePercent::GetValue(int frame, float& valOut) const {
   float a;
   x4_percentVal->GetValue(frame, a);
@@ -168,6 +204,11 @@ bool CRELifetimePercent::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRELifetimePercent::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a;
+  return x4_percentVal->Lower(prog, a) && prog.Emit(CElementProgram::EOp::LifetimePercent, regOut, 0.f, a);
+}
+
 bool CRESineWave::GetValue(int frame, float& valOut) const {
   float a, b, c;
   x4_frequency->GetValue(frame, a);
@@ -177,6 +218,12 @@ bool CRESineWave::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRESineWave::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b, c;
+  return x4_frequency->Lower(prog, a) && x8_amplitude->Lower(prog, b) && xc_phase->Lower(prog, c) &&
+         prog.Emit(CElementProgram::EOp::SineWave, regOut, 0.f, a, b, c);
+}
+
 bool CREInitialSwitch::GetValue(int frame, float& valOut) const {
   if (frame == 0) {
     x4_a->GetValue(0, valOut);
@@ -197,6 +244,12 @@ bool CRECompareLessThan::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRECompareLessThan::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b, c, d;
+  return x4_a->Lower(prog, a) && x8_b->Lower(prog, b) && xc_c->Lower(prog, c) && x10_d->Lower(prog, d) &&
+         prog.Emit(CElementProgram::EOp::CompareLessThan, regOut, 0.f, a, b, c, d);
+}
+
 bool CRECompareEquals::GetValue(int frame, float& valOut) const {
   float a, b;
   x4_a->GetValue(frame, a);
@@ -208,56 +261,102 @@ bool CRECompareEquals::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRECompareEquals::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b, c, d;
+  return x4_a->Lower(prog, a) && x8_b->Lower(prog, b) && xc_c->Lower(prog, c) && x10_d->Lower(prog, d) &&
+         prog.Emit(CElementProgram::EOp::CompareEquals, regOut, 0.f, a, b, c, d);
+}
+
 bool CREParticleAccessParam1::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[0];
   return false;
 }
 
+bool CREParticleAccessParam1::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 0.f);
+}
+
 bool CREParticleAccessParam2::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[1];
   return false;
 }
 
+bool CREParticleAccessParam2::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 1.f);
+}
+
 bool CREParticleAccessParam3::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[2];
   return false;
 }
 
+bool CREParticleAccessParam3::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 2.f);
+}
+
 bool CREParticleAccessParam4::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[3];
   return false;
 }
 
+bool CREParticleAccessParam4::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 3.f);
+}
+
 bool CREParticleAccessParam5::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[4];
   return false;
 }
 
+bool CREParticleAccessParam5::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 4.f);
+}
+
 bool CREParticleAccessParam6::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[5];
   return false;
 }
 
+bool CREParticleAccessParam6::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 5.f);
+}
+
 bool CREParticleAccessParam7::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[6];
   return false;
 }
 
+bool CREParticleAccessParam7::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 6.f);
+}
+
 bool CREParticleAccessParam8::GetValue(int /*frame*/, float& valOut) const {
   valOut = (*CParticleGlobals::instance()->m_particleAccessParameters)[7];
   return false;
 }
 
+bool CREParticleAccessParam8::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::AccessParam, regOut, 7.f);
+}
+
 bool CREParticleSizeOrLineLength::GetValue(int /*frame*/, float& valOut) const {
   valOut = CElementGen::g_currentParticle->x2c_lineLengthOrSize;
   return false;
 }
 
+bool CREParticleSizeOrLineLength::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::ParticleSize, regOut);
+}
+
 bool CREParticleRotationOrLineWidth::GetValue(int /*frame*/, float& valOut) const {
   valOut = CElementGen::g_currentParticle->x30_lineWidthOrRota;
   return false;
 }
 
+bool CREParticleRotationOrLineWidth::Lower(CElementProgram& prog, u8& regOut) const {
+  return prog.Emit(CElementProgram::EOp::ParticleRotation, regOut);
+}
+
 bool CRESubtract::GetValue(int frame, float& valOut) const {
   float a, b;
   x4_a->GetValue(frame, a);
@@ -266,6 +365,11 @@ bool CRESubtract::GetValue(int frame, float& valOut) const {
   return false;
 }
 
+bool CRESubtract::Lower(CElementProgram& prog, u8& regOut) const {
+  u8 a, b;
+  return x4_a->Lower(prog, a) && x8_b->Lower(prog, b) && prog.Emit(CElementProgram::EOp::Subtract, regOut, 0.f, a, b);
+}
+
 bool CREVectorMagnitude::GetValue(int frame, float& valOut) const {
   zeus::CVector3f a;
   x4_a->GetValue(frame, a);
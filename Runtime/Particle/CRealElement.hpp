@@ -22,6 +22,7 @@ class CREKeyframeEmitter : public CRealElement {
 public:
   explicit CREKeyframeEmitter(CInputStream& in);
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CRELifetimeTween : public CRealElement {
@@ -32,6 +33,7 @@ public:
   CRELifetimeTween(std::unique_ptr<CRealElement>&& a, std::unique_ptr<CRealElement>&& b)
   : x4_a(std::move(a)), x8_b(std::move(b)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREConstant : public CRealElement {
@@ -40,6 +42,7 @@ class CREConstant : public CRealElement {
 public:
   explicit CREConstant(float val) : x4_val(val) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
   bool IsConstant() const override { return true; }
 };
 
@@ -62,6 +65,7 @@ public:
   CREAdd(std::unique_ptr<CRealElement>&& a, std::unique_ptr<CRealElement>&& b)
   : x4_a(std::move(a)), x8_b(std::move(b)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREClamp : public CRealElement {
@@ -73,6 +77,7 @@ public:
   CREClamp(std::unique_ptr<CRealElement>&& a, std::unique_ptr<CRealElement>&& b, std::unique_ptr<CRealElement>&& c)
   : x4_min(std::move(a)), x8_max(std::move(b)), xc_val(std::move(c)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREInitialRandom : public CRealElement {
@@ -114,6 +119,7 @@ public:
   CREMultiply(std::unique_ptr<CRealElement>&& a, std::unique_ptr<CRealElement>&& b)
   : x4_a(std::move(a)), x8_b(std::move(b)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREPulse : public CRealElement {
@@ -135,6 +141,7 @@ class CRETimeScale : public CRealElement {
 public:
   explicit CRETimeScale(std::unique_ptr<CRealElement>&& a) : x4_a(std::move(a)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CRELifetimePercent : public CRealElement {
@@ -143,6 +150,7 @@ class CRELifetimePercent : public CRealElement {
 public:
   explicit CRELifetimePercent(std::unique_ptr<CRealElement>&& a) : x4_percentVal(std::move(a)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CRESineWave : public CRealElement {
@@ -154,6 +162,7 @@ public:
   CRESineWave(std::unique_ptr<CRealElement>&& a, std::unique_ptr<CRealElement>&& b, std::unique_ptr<CRealElement>&& c)
   : x4_frequency(std::move(b)), x8_amplitude(std::move(c)), xc_phase(std::move(a)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREInitialSwitch : public CRealElement {
@@ -177,6 +186,7 @@ public:
                      std::unique_ptr<CRealElement>&& c, std::unique_ptr<CRealElement>&& d)
   : x4_a(std::move(a)), x8_b(std::move(b)), xc_c(std::move(c)), x10_d(std::move(d)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CRECompareEquals : public CRealElement {
@@ -190,56 +200,67 @@ public:
                    std::unique_ptr<CRealElement>&& c, std::unique_ptr<CRealElement>&& d)
   : x4_a(std::move(a)), x8_b(std::move(b)), xc_c(std::move(c)), x10_d(std::move(d)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam1 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam2 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam3 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam4 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam5 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam6 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam7 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleAccessParam8 : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleSizeOrLineLength : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREParticleRotationOrLineWidth : public CRealElement {
 public:
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CRESubtract : public CRealElement {
@@ -250,6 +271,7 @@ public:
   CRESubtract(std::unique_ptr<CRealElement>&& a, std::unique_ptr<CRealElement>&& b)
   : x4_a(std::move(a)), x8_b(std::move(b)) {}
   bool GetValue(int frame, float& valOut) const override;
+  bool Lower(CElementProgram& prog, u8& regOut) const override;
 };
 
 class CREVectorMagnitude : public CRealElement {
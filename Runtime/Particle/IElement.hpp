@@ -9,6 +9,7 @@
 #include <zeus/CVector3f.hpp>
 
 namespace metaforce {
+class CElementProgram;
 
 class IElement {
 public:
@@ -19,6 +20,8 @@ class CRealElement : public IElement {
 public:
   virtual bool GetValue(int frame, float& valOut) const = 0;
   virtual bool IsConstant() const { return false; }
+  /* Appends this subtree to prog, see CElementProgram; false if it has no lowered form */
+  virtual bool Lower(CElementProgram& prog, u8& regOut) const { return false; }
 };
 
 class CIntElement : public IElement {
@@ -41,6 +44,7 @@ public:
 class CColorElement : public IElement {
 public:
   virtual bool GetValue(int frame, zeus::CColor& colorOut) const = 0;
+  virtual bool IsConstant() const { return false; }
 };
 
 class CEmitterElement : public IElement {
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "Runtime/RetroTypes.hpp"
+
+#include <zeus/CAABox.hpp>
+#include <zeus/CTransform.hpp>
+#include <zeus/CVector3f.hpp>
+
+namespace metaforce {
+
+/* Big-endian reader over a fully resident buffer, for parsers that would otherwise wrap it in
+ * CMemoryInStream. Reads never go through the CInputStream block buffer: scalars are an inline
+ * bounds check, memcpy and swap, and arrays are copied and swapped in bulk.
+ * Reading past the end yields zeroes and sets a sticky overrun flag rather than spinning on Read(). */
+class CMemoryReader {
+  std::span<const u8> m_data;
+  u32 m_pos = 0;
+  bool m_overrun = false;
+
+  bool Reserve(size_t len) {
+    if (len > m_data.size() - m_pos) {
+      m_pos = u32(m_data.size());
+      m_overrun = true;
+      return false;
+    }
+    return true;
+  }
+
+public:
+  explicit CMemoryReader(std::span<const u8> data) : m_data(data) {}
+  CMemoryReader(const void* ptr, u32 len) : m_data(static_cast<const u8*>(ptr), len) {}
+
+  u32 GetReadPosition() const { return m_pos; }
+  u32 GetRemaining() const { return u32(m_data.size()) - m_pos; }
+  bool HasOverrun() const { return m_overrun; }
+  const u8* GetCurrentPtr() const { return m_data.data() + m_pos; }
+
+  void Seek(u32 pos) {
+    if (pos > m_data.size()) {
+      pos = u32(m_data.size());
+      m_overrun = true;
+    }
+    m_pos = pos;
+  }
+  void Skip(u32 len) {
+    if (Reserve(len)) {
+      m_pos += len;
+    }
+  }
+
+  template <typename T>
+  requires std::is_arithmetic_v<T> T Get() {
+    if (!Reserve(sizeof(T))) {
+      return T{};
+    }
+    T ret;
+    std::memcpy(&ret, m_data.data() + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    if constexpr (sizeof(T) > 1) {
+      ret = SBig(ret);
+    }
+    return ret;
+  }
+
+  s8 ReadInt8() { return Get<s8>(); }
+  u8 ReadUint8() { return Get<u8>(); }
+  bool ReadBool() { return Get<u8>() != 0; }
+  s16 ReadShort() { return Get<s16>(); }
+  u16 ReadUint16() { return Get<u16>(); }
+  s32 ReadLong() { return Get<s32>(); }
+  u32 ReadUint32() { return Get<u32>(); }
+  s64 ReadLongLong() { return Get<s64>(); }
+  float ReadFloat() { return Get<float>(); }
+  double ReadDouble() { return Get<double>(); }
+
+  /* Fills out from the stream, converting every element to native order */
+  template <typename T>
+  requires std::is_arithmetic_v<T> void ReadArray(std::span<T> out) {
+    if (!Reserve(out.size_bytes())) {
+      std::fill(out.begin(), out.end(), T{});
+      return;
+    }
+    std::memcpy(out.data(), m_data.data() + m_pos, out.size_bytes());
+    m_pos += u32(out.size_bytes());
+    /* Each element swaps independently, so this vectorizes */
+    if constexpr (sizeof(T) > 1) {
+      for (T& v : out) {
+        v = SBig(v);
+      }
+    }
+  }
+
+  /* Zero-copy view of the next len bytes */
+  std::span<const u8> ReadBytes(u32 len) {
+    if (!Reserve(len)) {
+      return {};
+    }
+    const std::span<const u8> ret = m_data.subspan(m_pos, len);
+    m_pos += len;
+    return ret;
+  }
+
+  /* Same layouts as the cinput_stream_helper specializations in IOStreams.cpp */
+  zeus::CVector3f ReadVector3f() {
+    std::array<float, 3> v;
+    ReadArray<float>(v);
+    return {v[0], v[1], v[2]};
+  }
+  zeus::CAABox ReadAABox() {
+    std::array<float, 6> v;
+    ReadArray<float>(v);
+    return {v[0], v[1], v[2], v[3], v[4], v[5]};
+  }
+  zeus::CTransform ReadTransform() {
+    std::array<float, 12> v;
+    ReadArray<float>(v);
+    return zeus::CTransform(zeus::CMatrix3f(v[0], v[1], v[2], v[4], v[5], v[6], v[8], v[9], v[10]),
+                            zeus::CVector3f(v[3], v[7], v[11]));
+  }
+};
+
+} // namespace metaforce
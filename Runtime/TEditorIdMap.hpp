@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+
+/* Open-addressed hash table keyed on TEditorId, replacing the std::map/std::multimap tables
+ * CStateManager looks script objects up in. Slots live in one array and are probed linearly,
+ * so a lookup is a multiply, a shift and a short scan instead of a tree walk.
+ * Keys compare like TEditorId itself (layer bits ignored) and kInvalidEditorId marks an empty slot,
+ * so it can never be stored. Multiple entries per key are allowed through InsertMulti.
+ * Inserting may rehash, which invalidates iterators unless the table was reserved large enough. */
+template <typename V>
+class TEditorIdMap {
+public:
+  using value_type = std::pair<TEditorId, V>;
+
+private:
+  std::vector<value_type> m_slots;
+  size_t m_size = 0;
+  u32 m_shift = 32;
+
+  static constexpr size_t kNoSlot = SIZE_MAX;
+  static bool IsEmpty(const value_type& slot) { return slot.first == kInvalidEditorId; }
+  size_t Mask() const { return m_slots.size() - 1; }
+  size_t Home(TEditorId key) const { return u32((key.id & 0x3ffffff) * 0x9E3779B1u) >> m_shift; }
+
+  size_t FindSlot(TEditorId key) const {
+    if (m_size == 0) {
+      return kNoSlot;
+    }
+    for (size_t i = Home(key);; i = (i + 1) & Mask()) {
+      const value_type& slot = m_slots[i];
+      if (IsEmpty(slot)) {
+        return kNoSlot;
+      }
+      if (slot.first == key) {
+        return i;
+      }
+    }
+  }
+
+  size_t NextSlot(size_t i, TEditorId key) const {
+    for (i = (i + 1) & Mask();; i = (i + 1) & Mask()) {
+      const value_type& slot = m_slots[i];
+      if (IsEmpty(slot)) {
+        return kNoSlot;
+      }
+      if (slot.first == key) {
+        return i;
+      }
+    }
+  }
+
+  value_type& Place(TEditorId key, V&& value) {
+    size_t i = Home(key);
+    while (!IsEmpty(m_slots[i])) {
+      i = (i + 1) & Mask();
+    }
+    m_slots[i] = value_type(key, std::move(value));
+    ++m_size;
+    return m_slots[i];
+  }
+
+  void Rehash(size_t capacity) {
+    std::vector<value_type> old(capacity);
+    old.swap(m_slots);
+    m_shift = 32 - u32(std::countr_zero(capacity));
+    m_size = 0;
+    for (value_type& slot : old) {
+      if (!IsEmpty(slot)) {
+        Place(slot.first, std::move(slot.second));
+      }
+    }
+  }
+
+  void Grow() {
+    if ((m_size + 1) * 2 > m_slots.size()) {
+      Rehash(std::max(size_t(16), m_slots.size() * 2));
+    }
+  }
+
+  /* Backward-shift deletion keeps probe runs unbroken without tombstones */
+  void EraseSlot(size_t hole) {
+    m_slots[hole] = value_type();
+    --m_size;
+    for (size_t i = (hole + 1) & Mask(); !IsEmpty(m_slots[i]); i = (i + 1) & Mask()) {
+      const size_t home = Home(m_slots[i].first);
+      if (((i - home) & Mask()) >= ((i - hole) & Mask())) {
+        m_slots[hole] = std::move(m_slots[i]);
+        m_slots[i] = value_type();
+        hole = i;
+      }
+    }
+  }
+
+public:
+  /* Walks every entry of one key, in probe order */
+  class const_key_iterator {
+    friend class TEditorIdMap;
+    const TEditorIdMap* m_map = nullptr;
+    size_t m_slot = kNoSlot;
+    const_key_iterator(const TEditorIdMap* map, size_t slot) : m_map(map), m_slot(slot) {}
+
+  public:
+    const_key_iterator() = default;
+    const value_type& operator*() const { return m_map->m_slots[m_slot]; }
+    const value_type* operator->() const { return &m_map->m_slots[m_slot]; }
+    const_key_iterator& operator++() {
+      m_slot = m_map->NextSlot(m_slot, m_map->m_slots[m_slot].first);
+      return *this;
+    }
+    /* Every exhausted iterator compares equal, so a default-constructed one serves as end */
+    bool operator==(const const_key_iterator& other) const { return m_slot == other.m_slot; }
+    bool operator!=(const const_key_iterator& other) const { return m_slot != other.m_slot; }
+  };
+
+  /* Walks every entry in slot order */
+  template <typename Map, typename Value>
+  class slot_iterator {
+    friend class TEditorIdMap;
+    Map* m_map = nullptr;
+    size_t m_slot = 0;
+    slot_iterator(Map* map, size_t slot) : m_map(map), m_slot(slot) { Skip(); }
+    void Skip() {
+      while (m_slot < m_map->m_slots.size() && IsEmpty(m_map->m_slots[m_slot])) {
+        ++m_slot;
+      }
+    }
+
+  public:
+    Value& operator*() const { return m_map->m_slots[m_slot]; }
+    Value* operator->() const { return &m_map->m_slots[m_slot]; }
+    slot_iterator& operator++() {
+      ++m_slot;
+      Skip();
+      return *this;
+    }
+    bool operator==(const slot_iterator& other) const { return m_slot == other.m_slot; }
+    bool operator!=(const slot_iterator& other) const { return m_slot != other.m_slot; }
+  };
+  using iterator = slot_iterator<TEditorIdMap, value_type>;
+  using const_iterator = slot_iterator<const TEditorIdMap, const value_type>;
+
+  iterator begin() { return {this, 0}; }
+  iterator end() { return {this, m_slots.size()}; }
+  const_iterator begin() const { return {this, 0}; }
+  const_iterator end() const { return {this, m_slots.size()}; }
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  void clear() {
+    for (value_type& slot : m_slots) {
+      slot = value_type();
+    }
+    m_size = 0;
+  }
+
+  /* Sizes the table so count entries fit without a rehash */
+  void reserve(size_t count) {
+    const size_t capacity = std::bit_ceil(std::max(size_t(16), count * 2));
+    if (capacity > m_slots.size()) {
+      Rehash(capacity);
+    }
+  }
+
+  const value_type* FindEntry(TEditorId key) const {
+    const size_t slot = FindSlot(key);
+    return slot == kNoSlot ? nullptr : &m_slots[slot];
+  }
+  V* Find(TEditorId key) {
+    const size_t slot = FindSlot(key);
+    return slot == kNoSlot ? nullptr : &m_slots[slot].second;
+  }
+  const V* Find(TEditorId key) const {
+    const size_t slot = FindSlot(key);
+    return slot == kNoSlot ? nullptr : &m_slots[slot].second;
+  }
+
+  std::pair<const_key_iterator, const_key_iterator> EqualRange(TEditorId key) const {
+    return {const_key_iterator(this, FindSlot(key)), const_key_iterator()};
+  }
+
+  /* Unique-key access, default-constructing the value on first use like std::map::operator[] */
+  V& operator[](TEditorId key) {
+    if (V* val = Find(key)) {
+      return *val;
+    }
+    Grow();
+    return Place(key, V()).second;
+  }
+
+  void InsertMulti(TEditorId key, V value) {
+    Grow();
+    Place(key, std::move(value));
+  }
+
+  /* Removes the first entry of key whose value satisfies pred */
+  template <typename Pred>
+  bool EraseFirst(TEditorId key, Pred pred) {
+    for (size_t i = FindSlot(key); i != kNoSlot; i = NextSlot(i, key)) {
+      if (pred(m_slots[i].second)) {
+        EraseSlot(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Erase(TEditorId key) {
+    while (EraseFirst(key, [](const V&) { return true; })) {}
+  }
+
+  /* Removes every entry satisfying pred(const value_type&) */
+  template <typename Pred>
+  void EraseIf(Pred pred) {
+    for (size_t i = 0; i < m_slots.size();) {
+      /* A backward shift may pull an unvisited entry into slot i, so look at it again */
+      if (!IsEmpty(m_slots[i]) && pred(std::as_const(m_slots[i]))) {
+        EraseSlot(i);
+      } else {
+        ++i;
+      }
+    }
+  }
+};
+
+} // namespace metaforce
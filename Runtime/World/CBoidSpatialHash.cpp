@@ -0,0 +1,190 @@
+#include "Runtime/World/CBoidSpatialHash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace metaforce {
+namespace {
+/* Degenerate radii would otherwise make every boid its own cell */
+constexpr float kMinCellSize = 0.05f;
+} // Anonymous namespace
+
+std::array<s32, 3> CBoidSpatialHash::CellOf(const zeus::CVector3f& point) const {
+  std::array<s32, 3> ret;
+  for (size_t a = 0; a < 3; ++a) {
+    const float cell = std::floor(point[a] * m_invCellSize);
+    ret[a] = cell > -kMaxCellCoord ? s32(std::min(cell, kMaxCellCoord)) : s32(-kMaxCellCoord);
+  }
+  return ret;
+}
+
+void CBoidSpatialHash::Clear() {
+  m_bucketMask = 0;
+  m_bucketStarts.clear();
+  for (size_t a = 0; a < 3; ++a) {
+    m_pos[a].clear();
+    m_heading[a].clear();
+  }
+  m_index.clear();
+  m_stagePos.clear();
+  m_stageHeading.clear();
+  m_stageIndex.clear();
+}
+
+void CBoidSpatialHash::Add(const zeus::CVector3f& pos, const zeus::CVector3f& heading, u32 index) {
+  m_stagePos.push_back(pos);
+  m_stageHeading.push_back(heading);
+  m_stageIndex.push_back(index);
+}
+
+void CBoidSpatialHash::Build(float cellSize) {
+  const u32 count = u32(m_stagePos.size());
+  m_invCellSize = 1.f / std::max(cellSize, kMinCellSize);
+  /* Roughly one bucket per boid keeps collisions rare without a sparse table */
+  const u32 bucketCount = std::bit_ceil(std::max(count, 16u));
+  m_bucketMask = bucketCount - 1;
+
+  /* Counting sort by bucket; filling back to front leaves each bucket in Add() order */
+  m_bucketStarts.assign(bucketCount + 1, 0);
+  m_stageBucket.resize(count);
+  for (u32 i = 0; i < count; ++i) {
+    const std::array<s32, 3> cell = CellOf(m_stagePos[i]);
+    m_stageBucket[i] = BucketOf(cell[0], cell[1], cell[2]);
+    ++m_bucketStarts[m_stageBucket[i]];
+  }
+  for (u32 b = 1; b < bucketCount; ++b) {
+    m_bucketStarts[b] += m_bucketStarts[b - 1];
+  }
+  m_bucketStarts[bucketCount] = count;
+
+  for (size_t a = 0; a < 3; ++a) {
+    m_pos[a].resize(count);
+    m_heading[a].resize(count);
+  }
+  m_index.resize(count);
+  for (u32 i = count; i-- > 0;) {
+    const u32 slot = --m_bucketStarts[m_stageBucket[i]];
+    for (size_t a = 0; a < 3; ++a) {
+      m_pos[a][slot] = m_stagePos[i][a];
+      m_heading[a][slot] = m_stageHeading[i][a];
+    }
+    m_index[slot] = m_stageIndex[i];
+  }
+
+  m_stagePos.clear();
+  m_stageHeading.clear();
+  m_stageIndex.clear();
+}
+
+template <typename Func>
+void CBoidSpatialHash::VisitBuckets(const zeus::CVector3f& point, float radius, Func&& func) const {
+  if (m_index.empty()) {
+    return;
+  }
+
+  const std::array<s32, 3> lo = CellOf(point - zeus::CVector3f(radius));
+  const std::array<s32, 3> hi = CellOf(point + zeus::CVector3f(radius));
+  s64 cells = 1;
+  for (size_t a = 0; a < 3; ++a) {
+    cells *= s64(hi[a]) - s64(lo[a]) + 1;
+    if (cells <= 0) {
+      return;
+    }
+  }
+  if (cells > s64(kMaxQueryCells) || cells > s64(m_bucketMask) + 1) {
+    func(0u, u32(m_index.size()));
+    return;
+  }
+
+  /* Distinct cells may share a bucket; visiting it twice would count its boids twice */
+  std::array<u32, kMaxQueryCells> visited;
+  u32 visitedCount = 0;
+  for (s32 z = lo[2]; z <= hi[2]; ++z) {
+    for (s32 y = lo[1]; y <= hi[1]; ++y) {
+      for (s32 x = lo[0]; x <= hi[0]; ++x) {
+        const u32 bucket = BucketOf(x, y, z);
+        if (std::find(visited.begin(), visited.begin() + visitedCount, bucket) != visited.begin() + visitedCount) {
+          continue;
+        }
+        visited[visitedCount++] = bucket;
+        if (m_bucketStarts[bucket] != m_bucketStarts[bucket + 1] &&
+            !func(m_bucketStarts[bucket], m_bucketStarts[bucket + 1])) {
+          return;
+        }
+      }
+    }
+  }
+}
+
+SBoidNeighbourhood CBoidSpatialHash::Gather(const zeus::CVector3f& point, float radius, u32 maxCount) const {
+  SBoidNeighbourhood ret;
+  if (maxCount == 0) {
+    return ret;
+  }
+
+  const float radiusSq = radius * radius;
+  const float* px = m_pos[0].data();
+  const float* py = m_pos[1].data();
+  const float* pz = m_pos[2].data();
+  const float* hx = m_heading[0].data();
+  const float* hy = m_heading[1].data();
+  const float* hz = m_heading[2].data();
+  float sumPos[3] = {};
+  float sumHeading[3] = {};
+  u32 nearest = UINT32_MAX;
+  VisitBuckets(point, radius, [&](u32 begin, u32 end) {
+    for (u32 i = begin; i < end; ++i) {
+      const float dx = px[i] - point.x();
+      const float dy = py[i] - point.y();
+      const float dz = pz[i] - point.z();
+      const float distSq = dx * dx + dy * dy + dz * dz;
+      if (distSq == 0.f || !(distSq < radiusSq)) {
+        continue;
+      }
+      sumPos[0] += px[i];
+      sumPos[1] += py[i];
+      sumPos[2] += pz[i];
+      sumHeading[0] += hx[i];
+      sumHeading[1] += hy[i];
+      sumHeading[2] += hz[i];
+      if (distSq < ret.nearestDistSq) {
+        ret.nearestDistSq = distSq;
+        nearest = i;
+      }
+      if (++ret.count == maxCount) {
+        return false;
+      }
+    }
+    return true;
+  });
+
+  if (ret.count != 0) {
+    ret.posSum = zeus::CVector3f(sumPos[0], sumPos[1], sumPos[2]);
+    ret.headingSum = zeus::CVector3f(sumHeading[0], sumHeading[1], sumHeading[2]);
+    ret.nearestPos = zeus::CVector3f(px[nearest], py[nearest], pz[nearest]);
+  }
+  return ret;
+}
+
+void CBoidSpatialHash::FindInRadius(const zeus::CVector3f& point, float radius, std::vector<u32>& out) const {
+  out.clear();
+  const float radiusSq = radius * radius;
+  const float* px = m_pos[0].data();
+  const float* py = m_pos[1].data();
+  const float* pz = m_pos[2].data();
+  VisitBuckets(point, radius, [&](u32 begin, u32 end) {
+    for (u32 i = begin; i < end; ++i) {
+      const float dx = px[i] - point.x();
+      const float dy = py[i] - point.y();
+      const float dz = pz[i] - point.z();
+      if (dx * dx + dy * dy + dz * dz < radiusSq) {
+        out.push_back(m_index[i]);
+      }
+    }
+    return true;
+  });
+  std::sort(out.begin(), out.end());
+}
+
+} // namespace metaforce
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cfloat>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+#include <zeus/CVector3f.hpp>
+
+namespace metaforce {
+
+/* What the flocking rules need to know about a boid's neighbours, accumulated in one pass */
+struct SBoidNeighbourhood {
+  u32 count = 0;
+  zeus::CVector3f posSum;
+  zeus::CVector3f headingSum;
+  zeus::CVector3f nearestPos;
+  float nearestDistSq = FLT_MAX;
+
+  bool empty() const { return count == 0; }
+  zeus::CVector3f AveragePos() const { return posSum / float(count); }
+  zeus::CVector3f AverageHeading() const { return headingSum / float(count); }
+};
+
+/* Spatial hash over swarm boids, rebuilt once per think. Positions are bucketed into cubic cells sized
+ * to the swarm's neighbour radius, so a neighbour query only reads the few cells its sphere covers.
+ * Cells hash into a power-of-two bucket table; the boids are counting-sorted by bucket into flat
+ * position and heading arrays, so the query kernels are straight loops over contiguous floats.
+ * Boids are added with Add() and become visible to queries after Build(). */
+class CBoidSpatialHash {
+  /* Queries covering more cells than this scan every bucket instead */
+  static constexpr u32 kMaxQueryCells = 64;
+  /* Keeps cell coordinates integral for any finite position; NaN lands on the low edge */
+  static constexpr float kMaxCellCoord = 1048576.f;
+
+  float m_invCellSize = 1.f;
+  u32 m_bucketMask = 0;
+  std::vector<u32> m_bucketStarts;
+  std::array<std::vector<float>, 3> m_pos;
+  std::array<std::vector<float>, 3> m_heading;
+  std::vector<u32> m_index;
+
+  /* Staging for Add(), kept around so rebuilding does not allocate */
+  std::vector<zeus::CVector3f> m_stagePos;
+  std::vector<zeus::CVector3f> m_stageHeading;
+  std::vector<u32> m_stageIndex;
+  std::vector<u32> m_stageBucket;
+
+  std::array<s32, 3> CellOf(const zeus::CVector3f& point) const;
+  u32 BucketOf(s32 x, s32 y, s32 z) const {
+    return ((u32(x) * 73856093u) ^ (u32(y) * 19349663u) ^ (u32(z) * 83492791u)) & m_bucketMask;
+  }
+
+  /* Calls func(begin, end) once per distinct bucket whose cells intersect the sphere's bounds */
+  template <typename Func>
+  void VisitBuckets(const zeus::CVector3f& point, float radius, Func&& func) const;
+
+public:
+  void Clear();
+  /* index is handed back by FindInRadius, heading is summed by Gather */
+  void Add(const zeus::CVector3f& pos, const zeus::CVector3f& heading, u32 index);
+  void Build(float cellSize);
+
+  bool IsEmpty() const { return m_index.empty(); }
+
+  /* Sums the boids strictly within radius of point, skipping any exactly at point (the querying boid).
+   * Stops after maxCount neighbours, like the fixed-size near lists it replaces. */
+  SBoidNeighbourhood Gather(const zeus::CVector3f& point, float radius, u32 maxCount) const;
+
+  /* Fills out with the index of every boid strictly within radius of point, ascending */
+  void FindInRadius(const zeus::CVector3f& point, float radius, std::vector<u32>& out) const;
+};
+
+} // namespace metaforce
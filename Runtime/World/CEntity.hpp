@@ -45,7 +45,6 @@ protected:
   // Used in ImGuiConsole
   bool m_debugSelected = false;
   bool m_debugHovered = false;
-  const std::set<SConnection>* m_incomingConnections = nullptr;
 
 public:
   static const std::vector<SConnection> NullConnectionList;
@@ -84,7 +83,6 @@ public:
   const std::vector<SConnection>& GetConnectionList() const { return x20_conns; }
 
   std::string_view GetName() const { return x10_name; }
-  void SetIncomingConnectionList(const std::set<SConnection>* conns) { m_incomingConnections = conns; }
 };
 
 } // namespace metaforce
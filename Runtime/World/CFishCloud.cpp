@@ -77,9 +77,6 @@ CFishCloud::CFishCloud(TUniqueId uid, bool active, std::string_view name, const
   x21c_deathParticleCounts.push_back(partCount2);
   x21c_deathParticleCounts.push_back(partCount3);
   x21c_deathParticleCounts.push_back(partCount4);
-  const zeus::CAABox aabb = GetBoundingBox();
-  x238_partitionPitch = (aabb.max - aabb.min) / 7.f;
-  x244_ooPartitionPitch = 1.f / x238_partitionPitch;
 }
 
 void CFishCloud::Accept(IVisitor& visitor) { visitor.Visit(this); }
@@ -91,17 +88,14 @@ void CFishCloud::UpdateParticles(float dt) {
 }
 
 void CFishCloud::UpdatePartitionList() {
-  xf8_boidPartitionLists.clear();
-  xf8_boidPartitionLists.resize(xf8_boidPartitionLists.capacity());
-  const auto aabb = GetBoundingBox();
-  for (auto& b : xe8_boids) {
-    const zeus::CVector3f idxs = (b.x0_pos - aabb.min) * x244_ooPartitionPitch;
-    const int idx = int(idxs.x()) + int(idxs.y()) * 7 + int(idxs.z()) * 49;
-    if (idx >= 0 && idx < 343) {
-      b.x1c_next = xf8_boidPartitionLists[idx];
-      xf8_boidPartitionLists[idx] = &b;
+  m_boidHash.Clear();
+  for (u32 i = 0; i < xe8_boids.size(); ++i) {
+    const CBoid& b = xe8_boids[i];
+    if (b.x20_active) {
+      m_boidHash.Add(b.x0_pos, b.xc_vel, i);
     }
   }
+  m_boidHash.Build(x138_separationRadius);
 }
 
 bool CFishCloud::PointInBox(const zeus::CAABox& aabb, const zeus::CVector3f& point) const {
@@ -145,94 +139,6 @@ zeus::CPlane CFishCloud::FindClosestPlane(const zeus::CAABox& aabb, const zeus::
   }
 }
 
-CFishCloud::CBoid* CFishCloud::GetListAt(const zeus::CVector3f& pos) {
-  const zeus::CAABox aabb = GetBoundingBox();
-  const zeus::CVector3f ints = (pos - aabb.min) * x244_ooPartitionPitch;
-  const int idx = int(ints.x()) + int(ints.y()) * 7 + int(ints.z()) * 49;
-
-  if (idx < 0 || idx >= 343) {
-    return nullptr;
-  }
-
-  return xf8_boidPartitionLists[idx];
-}
-
-void CFishCloud::BuildBoidNearList(const zeus::CVector3f& pos, float radius,
-                                   rstl::reserved_vector<CBoid*, 25>& nearList) {
-  const float radiusSq = radius * radius;
-  CBoid* b = GetListAt(pos);
-
-  while (b != nullptr && nearList.size() < 25) {
-    if (b->x20_active) {
-      const float distSq = (b->GetTranslation() - pos).magSquared();
-      if (distSq != 0.f && distSq < radiusSq) {
-        nearList.push_back(b);
-      }
-    }
-    b = b->x1c_next;
-  }
-}
-
-void CFishCloud::BuildBoidNearPartitionList(const zeus::CVector3f& pos, float radius,
-                                            rstl::reserved_vector<CBoid*, 25>& nearList) {
-  const float radiusSq = radius * radius;
-  const zeus::CAABox aabb = GetBoundingBox();
-  const float x = std::max(radius * x244_ooPartitionPitch.x(), float(x238_partitionPitch.x()));
-  const float y = std::max(radius * x244_ooPartitionPitch.y(), float(x238_partitionPitch.y()));
-  const float z = std::max(radius * x244_ooPartitionPitch.z(), float(x238_partitionPitch.z()));
-  const float nx = 0.01f - x;
-  const float ny = 0.01f - y;
-  const float nz = 0.01f - z;
-
-  for (float lnx = nx; lnx < x; lnx += x238_partitionPitch.x()) {
-    const float cx = lnx + pos.x();
-    if (cx < aabb.min.x()) {
-      continue;
-    }
-    if (cx >= aabb.max.x()) {
-      break;
-    }
-    for (float lny = ny; lny < y; lny += x238_partitionPitch.y()) {
-      const float cy = lny + pos.y();
-      if (cy < aabb.min.y()) {
-        continue;
-      }
-      if (cy >= aabb.max.y()) {
-        break;
-      }
-      for (float lnz = nz; lnz < z; lnz += x238_partitionPitch.z()) {
-        const float cz = lnz + pos.z();
-        if (cz < aabb.min.z()) {
-          continue;
-        }
-        if (cz >= aabb.max.z()) {
-          break;
-        }
-        const zeus::CVector3f ints = (zeus::CVector3f(cx, cy, cz) - aabb.min) * x244_ooPartitionPitch;
-        const int idx = int(ints.x()) + int(ints.y()) * 7 + int(ints.z()) * 49;
-        if (idx < 0) {
-          continue;
-        }
-        if (idx < 343) {
-          CBoid* boid = xf8_boidPartitionLists[idx];
-          while (boid != nullptr) {
-            if (boid->x20_active) {
-              const float distSq = (boid->x0_pos - pos).magSquared();
-              if (distSq != 0.f && distSq < radiusSq) {
-                nearList.push_back(boid);
-                if (nearList.size() == 25) {
-                  return;
-                }
-              }
-            }
-            boid = boid->x1c_next;
-          }
-        }
-      }
-    }
-  }
-}
-
 void CFishCloud::PlaceBoid(CStateManager& mgr, CBoid& boid, const zeus::CAABox& aabb) const {
   const auto plane = FindClosestPlane(aabb, boid.x0_pos);
   boid.x0_pos -= plane.pointToPlaneDist(boid.x0_pos) * plane.normal() + 0.0001f * plane.normal();
@@ -256,22 +162,12 @@ void CFishCloud::PlaceBoid(CStateManager& mgr, CBoid& boid, const zeus::CAABox&
   }
 }
 
-void CFishCloud::ApplySeparation(CBoid& boid, const rstl::reserved_vector<CBoid*, 25>& nearList) const {
-  if (nearList.empty()) {
+void CFishCloud::ApplySeparation(CBoid& boid, const SBoidNeighbourhood& neighbours) const {
+  if (neighbours.empty()) {
     return;
   }
 
-  float minDist = FLT_MAX;
-  zeus::CVector3f pos;
-  for (const CBoid* b : nearList) {
-    const float dist = (boid.GetTranslation() - b->GetTranslation()).magSquared();
-    if (dist < minDist) {
-      minDist = dist;
-      pos = b->GetTranslation();
-    }
-  }
-
-  ApplySeparation(boid, pos, x138_separationRadius, x144_separationMagnitude);
+  ApplySeparation(boid, neighbours.nearestPos, x138_separationRadius, x144_separationMagnitude);
 }
 
 void CFishCloud::ApplySeparation(CBoid& boid, const zeus::CVector3f& separateFrom, float separationRadius,
@@ -290,18 +186,12 @@ void CFishCloud::ApplySeparation(CBoid& boid, const zeus::CVector3f& separateFro
   boid.xc_vel += (1.f - deltaDistSq / capDeltaDistSq) * delta.normalized() * separationMagnitude;
 }
 
-void CFishCloud::ApplyCohesion(CBoid& boid, const rstl::reserved_vector<CBoid*, 25>& nearList) const {
-  if (nearList.empty()) {
+void CFishCloud::ApplyCohesion(CBoid& boid, const SBoidNeighbourhood& neighbours) const {
+  if (neighbours.empty()) {
     return;
   }
 
-  zeus::CVector3f avg;
-  for (const CBoid* b : nearList) {
-    avg += b->GetTranslation();
-  }
-
-  avg = avg / float(nearList.size());
-  ApplyCohesion(boid, avg, x138_separationRadius, x13c_cohesionMagnitude);
+  ApplyCohesion(boid, neighbours.AveragePos(), x138_separationRadius, x13c_cohesionMagnitude);
 }
 
 void CFishCloud::ApplyCohesion(CBoid& boid, const zeus::CVector3f& cohesionFrom, float cohesionRadius,
@@ -316,17 +206,12 @@ void CFishCloud::ApplyCohesion(CBoid& boid, const zeus::CVector3f& cohesionFrom,
   boid.xc_vel += ((distSq > capDistSq) ? 1.f : distSq / capDistSq) * delta.normalized() * cohesionMagnitude;
 }
 
-void CFishCloud::ApplyAlignment(CBoid& boid, const rstl::reserved_vector<CBoid*, 25>& nearList) const {
-  if (nearList.empty()) {
+void CFishCloud::ApplyAlignment(CBoid& boid, const SBoidNeighbourhood& neighbours) const {
+  if (neighbours.empty()) {
     return;
   }
 
-  zeus::CVector3f avg;
-  for (const CBoid* b : nearList) {
-    avg += b->xc_vel;
-  }
-
-  avg = avg / float(nearList.size());
+  const zeus::CVector3f avg = neighbours.AverageHeading();
   boid.xc_vel += zeus::CVector3f::getAngleDiff(boid.xc_vel, avg) / M_PIF * (avg * x140_alignmentWeight);
 }
 
@@ -414,26 +299,21 @@ void CFishCloud::Think(float dt, CStateManager& mgr) {
     int idx = 0;
     for (auto& b : xe8_boids) {
       if (b.x20_active && (idx & x11c_updateMask) == (x118_thinkCounter & x11c_updateMask)) {
-        rstl::reserved_vector<CBoid*, 25> nearList;
-        if (x250_31_updateWithoutPartitions) {
-          BuildBoidNearList(b.x0_pos, x138_separationRadius, nearList);
-        } else {
-          BuildBoidNearPartitionList(b.x0_pos, x138_separationRadius, nearList);
-        }
+        const SBoidNeighbourhood neighbours = m_boidHash.Gather(b.x0_pos, x138_separationRadius, 25);
 
         for (int i = 0; i < 5; ++i) {
           switch (i) {
           case 1:
-            ApplySeparation(b, nearList);
+            ApplySeparation(b, neighbours);
             break;
           case 2:
             if (!x250_24_randomMovement || mgr.GetActiveRandom()->Float() > x12c_randomMovementTimer) {
-              ApplyCohesion(b, nearList);
+              ApplyCohesion(b, neighbours);
             }
             break;
           case 3:
             if (!x250_24_randomMovement || mgr.GetActiveRandom()->Float() > x12c_randomMovementTimer) {
-              ApplyAlignment(b, nearList);
+              ApplyAlignment(b, neighbours);
             }
             break;
           case 4:
@@ -506,8 +386,6 @@ void CFishCloud::Think(float dt, CStateManager& mgr) {
   }
 }
 
-void CFishCloud::CreatePartitionList() { xf8_boidPartitionLists.reserve(343); }
-
 void CFishCloud::AllocateSkinnedModels(CStateManager& mgr, CModelData::EWhichModel which) {
   x178_workspaces.clear();
   int idx = 0;
@@ -539,7 +417,6 @@ void CFishCloud::AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId sender, CSt
       xe8_boids.emplace_back(x34_transform * randPoint, vel,
                              0.2f * std::pow(mgr.GetActiveRandom()->Float(), 7.f) + 0.9f);
     }
-    CreatePartitionList();
     if (x250_27_validModel) {
       AllocateSkinnedModels(mgr, CModelData::EWhichModel::Normal);
     }
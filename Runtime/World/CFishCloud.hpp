@@ -6,6 +6,7 @@
 #include "Runtime/rstl.hpp"
 #include "Runtime/Particle/CElementGen.hpp"
 #include "Runtime/World/CActor.hpp"
+#include "Runtime/World/CBoidSpatialHash.hpp"
 
 #include <zeus/CVector3f.hpp>
 
@@ -17,7 +18,6 @@ class CFishCloud : public CActor {
     zeus::CVector3f x0_pos;
     zeus::CVector3f xc_vel;
     float x18_scale;
-    CBoid* x1c_next = nullptr;
     bool x20_active = true;
 
   public:
@@ -51,7 +51,7 @@ class CFishCloud : public CActor {
     }
   };
   std::vector<CBoid> xe8_boids;
-  std::vector<CBoid*> xf8_boidPartitionLists;
+  CBoidSpatialHash m_boidHash;
   std::vector<CModifierSource> x108_modifierSources;
   u32 x118_thinkCounter = 0;
   u32 x11c_updateMask;
@@ -85,8 +85,6 @@ class CFishCloud : public CActor {
   rstl::reserved_vector<u32, 4> x21c_deathParticleCounts;
   CModelData::EWhichModel x230_whichModel{};
   u16 x234_deathSfx;
-  zeus::CVector3f x238_partitionPitch;
-  zeus::CVector3f x244_ooPartitionPitch;
   bool x250_24_randomMovement : 1 = false;
   bool x250_25_worldSpace : 1 = true; // The result of a close_enough paradox (weird inlined test?)
   bool x250_26_enableWeaponRepelDamping : 1 = false;
@@ -94,24 +92,19 @@ class CFishCloud : public CActor {
   bool x250_28_killable : 1;
   bool x250_29_repelFromThreats : 1;
   bool x250_30_enablePlayerRepelDamping : 1 = false;
-  bool x250_31_updateWithoutPartitions : 1 = false;
 
   void UpdateParticles(float dt);
   void UpdatePartitionList();
   bool PointInBox(const zeus::CAABox& aabb, const zeus::CVector3f& point) const;
   zeus::CPlane FindClosestPlane(const zeus::CAABox& aabb, const zeus::CVector3f& point) const;
-  CBoid* GetListAt(const zeus::CVector3f& pos);
-  void BuildBoidNearList(const zeus::CVector3f& pos, float radius, rstl::reserved_vector<CBoid*, 25>& nearList);
-  void BuildBoidNearPartitionList(const zeus::CVector3f& pos, float radius,
-                                  rstl::reserved_vector<CBoid*, 25>& nearList);
   void PlaceBoid(CStateManager& mgr, CBoid& boid, const zeus::CAABox& aabb) const;
-  void ApplySeparation(CBoid& boid, const rstl::reserved_vector<CBoid*, 25>& nearList) const;
+  void ApplySeparation(CBoid& boid, const SBoidNeighbourhood& neighbours) const;
   void ApplySeparation(CBoid& boid, const zeus::CVector3f& separateFrom, float separationRadius,
                        float separationMagnitude) const;
-  void ApplyCohesion(CBoid& boid, const rstl::reserved_vector<CBoid*, 25>& nearList) const;
+  void ApplyCohesion(CBoid& boid, const SBoidNeighbourhood& neighbours) const;
   void ApplyCohesion(CBoid& boid, const zeus::CVector3f& cohesionFrom, float cohesionRadius,
                      float cohesionMagnitude) const;
-  void ApplyAlignment(CBoid& boid, const rstl::reserved_vector<CBoid*, 25>& nearList) const;
+  void ApplyAlignment(CBoid& boid, const SBoidNeighbourhood& neighbours) const;
   void ApplyAttraction(CBoid& boid, const zeus::CVector3f& attractTo, float attractionRadius,
                        float attractionMagnitude) const;
   void ApplyRepulsion(CBoid& boid, const zeus::CVector3f& attractTo, float repulsionRadius,
@@ -123,7 +116,6 @@ class CFishCloud : public CActor {
   void KillBoid(CBoid& b) const;
   zeus::CAABox GetUntransformedBoundingBox() const;
   zeus::CAABox GetBoundingBox() const;
-  void CreatePartitionList();
   void AllocateSkinnedModels(CStateManager& mgr, CModelData::EWhichModel which);
   void AddParticlesToRenderer() const;
   void RenderBoid(int idx, const CBoid& boid, u32& drawMask, bool thermalHot, const CModelFlags& flags) const;
@@ -1,5 +1,6 @@
 #include "Runtime/World/CFluidPlaneCPU.hpp"
 
+#include "Runtime/CJobPool.hpp"
 #include "Runtime/CSimplePool.hpp"
 #include "Runtime/CStateManager.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
@@ -10,9 +11,110 @@
 
 #include "TCastTo.hpp" // Generated file, do not modify include path
 
+#include <climits>
+
+#include <optick.h>
+
 namespace metaforce {
 constexpr u32 kTableSize = 2048;
 
+namespace {
+using SHFieldSample = CFluidPlaneRender::SHFieldSample;
+/* Every row kernel works on at most one height field row */
+constexpr int kRowSize = int(std::tuple_size_v<CFluidPlane::Heights::value_type>);
+
+u8 WavecapIntensity(float height, float scale) {
+  return height > 0.f ? u8(std::min(255, int(scale * height))) : u8(0);
+}
+
+void UpdateWavecapRow(SHFieldSample* row, int from, int to, float wavecapScale) {
+  for (int l = from; l < to; ++l) {
+    row[l].wavecapIntensity = WavecapIntensity(row[l].height, wavecapScale);
+  }
+}
+
+/* Normals and wavecaps for samples [from, to) of row k. The gradients are computed into flat
+ * arrays first so that pass vectorizes; the second pass packs them into the interleaved samples. */
+void UpdateNormalRow(CFluidPlane::Heights& heights, int k, int from, int to, float normalScale, float nz,
+                     float wavecapScale) {
+  const int count = std::min(to, kRowSize - 1) - from;
+  if (count <= 0) {
+    return;
+  }
+
+  std::array<float, kRowSize> nxs;
+  std::array<float, kRowSize> nys;
+  std::array<float, kRowSize> scales;
+  const SHFieldSample* row = heights[k].data() + from;
+  const SHFieldSample* up = heights[k + 1].data() + from;
+  const SHFieldSample* down = heights[k - 1].data() + from;
+  for (int i = 0; i < count; ++i) {
+    const float nx = (row[i + 1].height - row[i - 1].height) * normalScale;
+    const float ny = (up[i].height - down[i].height) * normalScale;
+    nxs[i] = nx;
+    nys[i] = ny;
+    scales[i] = 63.f / std::sqrt(ny * ny + nx * nx + nz * nz);
+  }
+
+  SHFieldSample* out = heights[k].data() + from;
+  for (int i = 0; i < count; ++i) {
+    out[i].nx = s8(nxs[i] * scales[i]);
+    out[i].ny = s8(nys[i] * scales[i]);
+    out[i].nz = s8(nz * scales[i]);
+    out[i].wavecapIntensity = WavecapIntensity(out[i].height, wavecapScale);
+  }
+}
+
+/* One ripple's contribution to a row of samples */
+struct SRippleKernel {
+  const CFluidPlaneCPU::SineTable& sineWave;
+  const u8* rippleValues;
+  float minDistSq;
+  float maxDistSq;
+  float distFalloff;
+  float lookupPhase;
+  float lookupT;
+  float amplitude;
+  /* With tessellation the heights are evaluated on the GPU, so only coverage is needed */
+  bool coverageOnly;
+
+  /* Adds the ripple to samples [from, to] of row, skipping (skipFrom, skipTo). xModSq is indexed by sample
+   * column. Distances are computed for the whole span up front so that pass vectorizes; only samples inside
+   * the ripple's ring do the table lookups. Returns whether any sample is inside the ring. */
+  bool AccumulateRow(SHFieldSample* row, const float* xModSq, int from, int to, int skipFrom, int skipTo,
+                     float yModSq) const {
+    to = std::min(to, kRowSize - 1);
+    if (to < from) {
+      return false;
+    }
+
+    std::array<float, kRowSize> dists;
+    std::array<bool, kRowSize> inRing;
+    for (int l = from; l <= to; ++l) {
+      const float distSq = xModSq[l] + yModSq;
+      inRing[l] = !(distSq < minDistSq || distSq > maxDistSq) && (l <= skipFrom || l >= skipTo);
+      dists[l] = std::sqrt(distSq);
+    }
+
+    bool added = false;
+    for (int l = from; l <= to; ++l) {
+      if (!inRing[l]) {
+        continue;
+      }
+      added = true;
+      if (coverageOnly) {
+        break;
+      }
+      const float divDist = dists[l];
+      if (const u8 rippleV = rippleValues[int(divDist * distFalloff)]) {
+        row[l].height += rippleV * amplitude * sineWave[size_t(divDist * lookupPhase + lookupT) & 0xff];
+      }
+    }
+    return added;
+  }
+};
+} // Anonymous namespace
+
 CFluidPlaneCPU::CTurbulence::CTurbulence(float speed, float distance, float freqMax, float freqMin, float phaseMax,
                                          float phaseMin, float amplitudeMax, float amplitudeMin)
 : x0_speed(speed)
@@ -323,15 +425,26 @@ void CFluidPlaneCPU::ApplyTurbulence(float t, Heights& heights, const Flags& fla
   int yDivs = (info.x1_ySubdivs + CFluidPlaneRender::numSubdivisionsInTile - 4) /
                   CFluidPlaneRender::numSubdivisionsInTile * CFluidPlaneRender::numSubdivisionsInTile +
               2;
-  for (int i = 0; i <= yDivs; ++i) {
-    float curYSq = curY * curY;
-    float curX = info.x4_localMin.x() - info.x18_rippleResolution - areaCenter.x();
-    for (int j = 0; j <= xDivs; ++j) {
-      float distFac = curX * curX + curYSq;
-      if (distFac != 0.f)
-        distFac = std::sqrt(distFac);
-      heights[i][j].height = GetTurbulenceHeight(GetOOTurbulenceDistance() * distFac + scaledT);
-      curX += info.x18_rippleResolution;
+  const int xCount = std::min(xDivs + 1, kRowSize);
+  const int yCount = std::min(yDivs + 1, kRowSize);
+
+  /* Every row shares the same columns, so their squares are computed once */
+  std::array<float, kRowSize> curXSq;
+  float curX = info.x4_localMin.x() - info.x18_rippleResolution - areaCenter.x();
+  for (int j = 0; j < xCount; ++j) {
+    curXSq[j] = curX * curX;
+    curX += info.x18_rippleResolution;
+  }
+
+  const float ooDistance = GetOOTurbulenceDistance();
+  std::array<float, kRowSize> sel;
+  for (int i = 0; i < yCount; ++i) {
+    const float curYSq = curY * curY;
+    for (int j = 0; j < xCount; ++j) {
+      sel[j] = ooDistance * std::sqrt(curXSq[j] + curYSq) + scaledT;
+    }
+    for (int j = 0; j < xCount; ++j) {
+      heights[i][j].height = GetTurbulenceHeight(sel[j]);
     }
     curY += info.x18_rippleResolution;
   }
@@ -369,6 +482,16 @@ void CFluidPlaneCPU::ApplyRipple(const CFluidPlaneRender::SRippleInfo& rippleInf
   int gridCells = info.x2a_gridDimX * info.x2c_gridDimY;
   float distFalloff = 64.f * rippleInfo.x0_ripple.GetOODistanceFalloff();
   int curYDiv = rippleInfo.xc_fromY;
+  const SRippleKernel kernel{sineWave,
+                             CFluidPlaneManager::RippleValues[lifeIdx].data(),
+                             minDistSq,
+                             maxDistSq,
+                             distFalloff,
+                             rippleInfo.x0_ripple.GetLookupPhase(),
+                             lookupT,
+                             rippleInfo.x0_ripple.GetLookupAmplitude(),
+                             m_tessellation};
+  std::array<float, kRowSize> xModSq;
 
   for (int i = fromY; i <= toY; ++i, curY -= info.x14_tileSize) {
     int nextYDiv = (i + 1) * CFluidPlaneRender::numSubdivisionsInTile;
@@ -391,32 +514,19 @@ void CFluidPlaneCPU::ApplyRipple(const CFluidPlaneRender::SRippleInfo& rippleInf
       float curYMod =
           (rippleInfo.x0_ripple.GetCenter().y() - info.xc_globalMin.y()) - info.x18_rippleResolution * curYDiv;
 
+      /* Column distances are the same for every row of the tile */
+      const int lastXDiv = std::min({rippleInfo.x8_toX, nextXDiv - 1, kRowSize - 1});
+      float tmpXMod = curXMod;
+      for (int l = curXDiv; l <= lastXDiv; ++l, tmpXMod -= info.x18_rippleResolution) {
+        xModSq[l] = tmpXMod * tmpXMod;
+      }
+
       if (!info.x30_gridFlags || (info.x30_gridFlags && curGridY >= 0 && curGridY < gridCells && curGridX >= 0 &&
                                   curGridX < info.x2a_gridDimX && info.x30_gridFlags[curGridX + curGridY])) {
         for (int k = curYDiv; k <= std::min(rippleInfo.x10_toY, nextYDiv - 1);
              ++k, curYMod -= info.x18_rippleResolution) {
-          float tmpXMod = curXMod;
-          float curYModSq = curYMod * curYMod;
-          for (int l = curXDiv; l <= std::min(rippleInfo.x8_toX, nextXDiv - 1);
-               ++l, tmpXMod -= info.x18_rippleResolution) {
-            float divDistSq = tmpXMod * tmpXMod + curYModSq;
-            if (divDistSq < minDistSq || divDistSq > maxDistSq)
-              continue;
-
-            if (m_tessellation) {
-              /* This will be evaluated in tessellation shader instead */
-              addedRipple = true;
-              break;
-            }
-
-            float divDist = (divDistSq != 0.f) ? std::sqrt(divDistSq) : 0.f;
-            if (u8 rippleV = CFluidPlaneManager::RippleValues[lifeIdx][int(divDist * distFalloff)]) {
-              heights[k][l].height +=
-                  rippleV * rippleInfo.x0_ripple.GetLookupAmplitude() *
-                  sineWave[size_t(divDist * rippleInfo.x0_ripple.GetLookupPhase() + lookupT) & 0xff];
-            } else {
-              heights[k][l].height += 0.f;
-            }
+          if (kernel.AccumulateRow(heights[k].data(), xModSq.data(), curXDiv, lastXDiv, INT_MAX, INT_MAX,
+                                   curYMod * curYMod)) {
             addedRipple = true;
           }
         }
@@ -446,31 +556,11 @@ void CFluidPlaneCPU::ApplyRipple(const CFluidPlaneRender::SRippleInfo& rippleInf
 
         for (int k = curYDiv; k <= std::min(rippleInfo.x10_toY, nextYDiv - 1);
              ++k, curYMod -= info.x18_rippleResolution) {
-          float tmpXMod = curXMod;
-          float curYModSq = curYMod * curYMod;
-          for (int l = curXDiv; l <= std::min(rippleInfo.x8_toX, nextXDiv - 1);
-               ++l, tmpXMod -= info.x18_rippleResolution) {
-            if (k <= yMax || k >= yMin || l <= xMax || l >= xMin) {
-              float divDistSq = tmpXMod * tmpXMod + curYModSq;
-              if (divDistSq < minDistSq || divDistSq > maxDistSq)
-                continue;
-
-              if (m_tessellation) {
-                /* This will be evaluated in tessellation shader instead */
-                addedRipple = true;
-                break;
-              }
-
-              float divDist = (divDistSq != 0.f) ? std::sqrt(divDistSq) : 0.f;
-              if (u8 rippleV = CFluidPlaneManager::RippleValues[lifeIdx][int(divDist * distFalloff)]) {
-                heights[k][l].height +=
-                    rippleV * rippleInfo.x0_ripple.GetLookupAmplitude() *
-                    sineWave[size_t(divDist * rippleInfo.x0_ripple.GetLookupPhase() + lookupT) & 0xff];
-              } else {
-                heights[k][l].height += 0.f;
-              }
-              addedRipple = true;
-            }
+          /* Rows along the tile's outer edges take every column, inner rows only the outer columns */
+          const bool edgeRow = k <= yMax || k >= yMin;
+          if (kernel.AccumulateRow(heights[k].data(), xModSq.data(), curXDiv, lastXDiv, edgeRow ? INT_MAX : xMax,
+                                   edgeRow ? INT_MAX : xMin, curYMod * curYMod)) {
+            addedRipple = true;
           }
 
           if (m_tessellation && addedRipple)
@@ -519,42 +609,23 @@ void CFluidPlaneCPU::UpdatePatchNoNormals(Heights& heights, const Flags& flags,
       int x28 = std::min(r29, info.x0_xSubdivs + 1);
       if ((flags[i][j] & 0x1f) == 0x1f) {
         for (int k = r9; k < x24; ++k) {
-          for (int l = r11; l < x28; ++l) {
-            CFluidPlaneRender::SHFieldSample& sample = heights[k][l];
-            if (sample.height > 0.f)
-              sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-            else
-              sample.wavecapIntensity = 0;
-          }
+          UpdateWavecapRow(heights[k].data(), r11, x28, info.x38_wavecapIntensityScale);
         }
       } else {
         if (i > 0 && i < CFluidPlaneRender::numTilesInHField + 1 && j > 0 &&
             j < CFluidPlaneRender::numTilesInHField + 1) {
           int halfSubdivs = CFluidPlaneRender::numSubdivisionsInTile / 2;
-          CFluidPlaneRender::SHFieldSample& sample = heights[halfSubdivs + r9][halfSubdivs + r11];
-          if (sample.height > 0.f)
-            sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-          else
-            sample.wavecapIntensity = 0;
+          UpdateWavecapRow(heights[halfSubdivs + r9].data(), halfSubdivs + r11, halfSubdivs + r11 + 1,
+                           info.x38_wavecapIntensityScale);
         }
 
         if (i != 0) {
-          for (int l = r11; l < x28; ++l) {
-            CFluidPlaneRender::SHFieldSample& sample = heights[r9][l];
-            if (sample.height > 0.f)
-              sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-            else
-              sample.wavecapIntensity = 0;
-          }
+          UpdateWavecapRow(heights[r9].data(), r11, x28, info.x38_wavecapIntensityScale);
         }
 
         if (j != 0) {
           for (int k = r9 + 1; k < x24; ++k) {
-            CFluidPlaneRender::SHFieldSample& sample = heights[k][r11];
-            if (sample.height > 0.f)
-              sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-            else
-              sample.wavecapIntensity = 0;
+            UpdateWavecapRow(heights[k].data(), r11, r11 + 1, info.x38_wavecapIntensityScale);
           }
         }
       }
@@ -566,6 +637,7 @@ void CFluidPlaneCPU::UpdatePatchWithNormals(Heights& heights, const Flags& flags
                                             const CFluidPlaneRender::SPatchInfo& info) {
   float normalScale = -(2.f * info.x18_rippleResolution);
   float nz = 0.25f * 2.f * info.x18_rippleResolution;
+  const float wavecapScale = info.x38_wavecapIntensityScale;
   int curGridY = info.x2e_tileY * info.x2a_gridDimX - 1 + info.x28_tileX;
   for (int i = 1; i <= (info.x1_ySubdivs + CFluidPlaneRender::numSubdivisionsInTile - 2) /
                            CFluidPlaneRender::numSubdivisionsInTile;
@@ -581,26 +653,7 @@ void CFluidPlaneCPU::UpdatePatchWithNormals(Heights& heights, const Flags& flags
       r12 -= CFluidPlaneRender::numSubdivisionsInTile;
       if ((flags[i][j] & 0x1f) == 0x1f) {
         for (int k = r9; k < x38; ++k) {
-          for (int l = r12; l < x3c; ++l) {
-            CFluidPlaneRender::SHFieldSample& sample = heights[k][l];
-            CFluidPlaneRender::SHFieldSample& up = heights[k + 1][l];
-            CFluidPlaneRender::SHFieldSample& down = heights[k - 1][l];
-            CFluidPlaneRender::SHFieldSample& right = heights[k][l + 1];
-            CFluidPlaneRender::SHFieldSample& left = heights[k][l - 1];
-            float nx = (right.height - left.height) * normalScale;
-            float ny = (up.height - down.height) * normalScale;
-            float normalizer = ny * ny + nx * nx + nz * nz;
-            if (normalizer != 0.f)
-              normalizer = std::sqrt(normalizer);
-            normalizer = 63.f / normalizer;
-            sample.nx = s8(nx * normalizer);
-            sample.ny = s8(ny * normalizer);
-            sample.nz = s8(nz * normalizer);
-            if (sample.height > 0.f)
-              sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-            else
-              sample.wavecapIntensity = 0;
-          }
+          UpdateNormalRow(heights, k, r12, x3c, normalScale, nz, wavecapScale);
         }
       } else {
         if (!info.x30_gridFlags || info.x30_gridFlags[curGridY + j]) {
@@ -609,90 +662,19 @@ void CFluidPlaneCPU::UpdatePatchWithNormals(Heights& heights, const Flags& flags
             int halfSubdivs = CFluidPlaneRender::numSubdivisionsInTile / 2;
             int k = halfSubdivs + r9;
             int l = halfSubdivs + r12;
-            CFluidPlaneRender::SHFieldSample& sample = heights[k][l];
-            CFluidPlaneRender::SHFieldSample& up = heights[k + 1][l];
-            CFluidPlaneRender::SHFieldSample& down = heights[k - 1][l];
-            CFluidPlaneRender::SHFieldSample& right = heights[k][l + 1];
-            CFluidPlaneRender::SHFieldSample& left = heights[k][l - 1];
-            float nx = (right.height - left.height) * normalScale;
-            float ny = (up.height - down.height) * normalScale;
-            float normalizer = ny * ny + nx * nx + nz * nz;
-            if (normalizer != 0.f)
-              normalizer = std::sqrt(normalizer);
-            normalizer = 63.f / normalizer;
-            sample.nx = s8(nx * normalizer);
-            sample.ny = s8(ny * normalizer);
-            sample.nz = s8(nz * normalizer);
-            if (sample.height > 0.f)
-              sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-            else
-              sample.wavecapIntensity = 0;
+            UpdateNormalRow(heights, k, l, l + 1, normalScale, nz, wavecapScale);
           }
         }
 
         if (j != 0 && i != 0) {
           if ((flags[i][j] & 2) != 0 || (flags[i - 1][j] & 1) != 0 || (flags[i][j] & 4) != 0 ||
               (flags[i][j - 1] & 8) != 0) {
-            for (int l = r12; l < x3c; ++l) {
-              CFluidPlaneRender::SHFieldSample& sample = heights[r9][l];
-              CFluidPlaneRender::SHFieldSample& up = heights[r9 + 1][l];
-              CFluidPlaneRender::SHFieldSample& down = heights[r9 - 1][l];
-              CFluidPlaneRender::SHFieldSample& right = heights[r9][l + 1];
-              CFluidPlaneRender::SHFieldSample& left = heights[r9][l - 1];
-              float nx = (right.height - left.height) * normalScale;
-              float ny = (up.height - down.height) * normalScale;
-              float normalizer = ny * ny + nx * nx + nz * nz;
-              if (normalizer != 0.f)
-                normalizer = std::sqrt(normalizer);
-              normalizer = 63.f / normalizer;
-              sample.nx = s8(nx * normalizer);
-              sample.ny = s8(ny * normalizer);
-              sample.nz = s8(nz * normalizer);
-              if (sample.height > 0.f)
-                sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-              else
-                sample.wavecapIntensity = 0;
-            }
-
+            UpdateNormalRow(heights, r9, r12, x3c, normalScale, nz, wavecapScale);
             for (int k = r9; k < x38; ++k) {
-              CFluidPlaneRender::SHFieldSample& sample = heights[k][r12];
-              CFluidPlaneRender::SHFieldSample& up = heights[k + 1][r12];
-              CFluidPlaneRender::SHFieldSample& down = heights[k - 1][r12];
-              CFluidPlaneRender::SHFieldSample& right = heights[k][r12 + 1];
-              CFluidPlaneRender::SHFieldSample& left = heights[k][r12 - 1];
-              float nx = (right.height - left.height) * normalScale;
-              float ny = (up.height - down.height) * normalScale;
-              float normalizer = ny * ny + nx * nx + nz * nz;
-              if (normalizer != 0.f)
-                normalizer = std::sqrt(normalizer);
-              normalizer = 63.f / normalizer;
-              sample.nx = s8(nx * normalizer);
-              sample.ny = s8(ny * normalizer);
-              sample.nz = s8(nz * normalizer);
-              if (sample.height > 0.f)
-                sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-              else
-                sample.wavecapIntensity = 0;
+              UpdateNormalRow(heights, k, r12, r12 + 1, normalScale, nz, wavecapScale);
             }
           } else {
-            CFluidPlaneRender::SHFieldSample& sample = heights[r9][r12];
-            CFluidPlaneRender::SHFieldSample& up = heights[r9 + 1][r12];
-            CFluidPlaneRender::SHFieldSample& down = heights[r9 - 1][r12];
-            CFluidPlaneRender::SHFieldSample& right = heights[r9][r12 + 1];
-            CFluidPlaneRender::SHFieldSample& left = heights[r9][r12 - 1];
-            float nx = (right.height - left.height) * normalScale;
-            float ny = (up.height - down.height) * normalScale;
-            float normalizer = ny * ny + nx * nx + nz * nz;
-            if (normalizer != 0.f)
-              normalizer = std::sqrt(normalizer);
-            normalizer = 63.f / normalizer;
-            sample.nx = s8(nx * normalizer);
-            sample.ny = s8(ny * normalizer);
-            sample.nz = s8(nz * normalizer);
-            if (sample.height > 0.f)
-              sample.wavecapIntensity = u8(std::min(255, int(info.x38_wavecapIntensityScale * sample.height)));
-            else
-              sample.wavecapIntensity = 0;
+            UpdateNormalRow(heights, r9, r12, r12 + 1, normalScale, nz, wavecapScale);
           }
         }
       }
@@ -700,42 +682,75 @@ void CFluidPlaneCPU::UpdatePatchWithNormals(Heights& heights, const Flags& flags
   }
 }
 
-bool CFluidPlaneCPU::UpdatePatch(float time, const CFluidPlaneRender::SPatchInfo& info, Heights& heights, Flags& flags,
-                                 const zeus::CVector3f& areaCenter, const std::optional<CRippleManager>& rippleManager,
-                                 int fromX, int toX, int fromY, int toY) const {
-  rstl::reserved_vector<CFluidPlaneRender::SRippleInfo, 32> rippleInfos;
-  if (rippleManager) {
-    for (const CRipple& ripple : rippleManager->GetRipples()) {
-      if (ripple.GetTime() >= ripple.GetTimeFalloff())
-        continue;
-      CFluidPlaneRender::SRippleInfo rippleInfo(ripple, fromX, toX, fromY, toY);
-      if (PrepareRipple(ripple, info, rippleInfo))
-        rippleInfos.push_back(rippleInfo);
-    }
+void CFluidPlaneCPU::PrepareRipples(const CFluidPlaneRender::SPatchInfo& info,
+                                    const std::optional<CRippleManager>& rippleManager, int fromX, int toX, int fromY,
+                                    int toY, rstl::reserved_vector<CFluidPlaneRender::SRippleInfo, 32>& rippleInfos) {
+  if (!rippleManager)
+    return;
+  for (const CRipple& ripple : rippleManager->GetRipples()) {
+    if (ripple.GetTime() >= ripple.GetTimeFalloff())
+      continue;
+    CFluidPlaneRender::SRippleInfo rippleInfo(ripple, fromX, toX, fromY, toY);
+    if (PrepareRipple(ripple, info, rippleInfo))
+      rippleInfos.push_back(rippleInfo);
   }
+}
 
-  if (rippleInfos.empty())
-    return true;
-
+void CFluidPlaneCPU::UpdatePatch(float time, const CFluidPlaneRender::SPatchInfo& info,
+                                 const rstl::reserved_vector<CFluidPlaneRender::SRippleInfo, 32>& rippleInfos,
+                                 Heights& heights, Flags& flags, const zeus::CVector3f& areaCenter) const {
+  /* Scratch is reused between patches, so start from no rippled tiles */
+  flags = {};
   ApplyTurbulence(time, heights, flags, sGlobalSineWave, info, areaCenter);
   ApplyRipples(rippleInfos, heights, flags, sGlobalSineWave, info);
 
   /* No further action necessary if using tessellation shaders */
   if (m_tessellation)
-    return false;
+    return;
 
   if (info.x37_normalMode == CFluidPlaneRender::NormalMode::NoNormals)
     UpdatePatchNoNormals(heights, flags, info);
   else
     UpdatePatchWithNormals(heights, flags, info);
-
-  return false;
 }
 
-// Used to be part of locked cache
-// These are too big for stack allocation
-static CFluidPlane::Heights lc_heights{};
-static CFluidPlane::Flags lc_flags{};
+// Patches without ripples are drawn flat and never read these
+static const CFluidPlane::Heights sFlatHeights{};
+static const CFluidPlane::Flags sFlatFlags{};
+
+/* Builds the height fields of the batch's rippled patches on the job pool, then emits every patch in order.
+ * RenderPatch binds shader state, so it stays on the calling thread. */
+void CFluidPlaneCPU::RenderPatchBatch(float time, std::span<const SPatchJob> jobs, const zeus::CVector3f& areaCenter) {
+  rstl::reserved_vector<u32, kPatchBatchSize> rippled;
+  for (u32 i = 0; i < jobs.size(); ++i) {
+    if (!jobs[i].rippleInfos.empty()) {
+      rippled.push_back(i);
+    }
+  }
+  while (m_patchScratch.size() < rippled.size()) {
+    m_patchScratch.push_back(std::make_unique<SPatchScratch>());
+  }
+
+  /* Scratch slot n belongs to the nth rippled patch */
+  CJobPool::Shared().ParallelFor(rippled.size(), 1, [&](size_t begin, size_t end) {
+    OPTICK_EVENT("Fluid patch job");
+    for (size_t n = begin; n < end; ++n) {
+      const SPatchJob& job = jobs[rippled[n]];
+      SPatchScratch& scratch = *m_patchScratch[n];
+      UpdatePatch(time, job.info, job.rippleInfos, scratch.heights, scratch.flags, areaCenter);
+    }
+  });
+
+  size_t n = 0;
+  for (const SPatchJob& job : jobs) {
+    if (job.rippleInfos.empty()) {
+      RenderPatch(job.info, sFlatHeights, sFlatFlags, true, job.flagIs1, m_verts, m_pVerts);
+    } else {
+      const SPatchScratch& scratch = *m_patchScratch[n++];
+      RenderPatch(job.info, scratch.heights, scratch.flags, false, job.flagIs1, m_verts, m_pVerts);
+    }
+  }
+}
 
 void CFluidPlaneCPU::Render(const CStateManager& mgr, float alpha, const zeus::CAABox& aabb, const zeus::CTransform& xf,
                             const zeus::CTransform& areaXf, bool noNormals, const zeus::CFrustum& frustum,
@@ -820,6 +835,8 @@ void CFluidPlaneCPU::Render(const CStateManager& mgr, float alpha, const zeus::C
     m_shader->prepareDraw(setupInfo);
   }
 
+  const float time = mgr.GetFluidPlaneManager()->GetUVT();
+  m_patchJobs.reserve(kPatchBatchSize);
   u32 tileY = 0;
   float curY = aabb.min.y();
   for (int i = 0; curY < aabb.max.y() && i < patchDimY; ++i) {
@@ -855,9 +872,12 @@ void CFluidPlaneCPU::Render(const CStateManager& mgr, float alpha, const zeus::C
           else
             toY = info.x1_ySubdivs;
 
-          bool noRipples = UpdatePatch(mgr.GetFluidPlaneManager()->GetUVT(), info, lc_heights, lc_flags, areaCenter,
-                                       rippleManager, fromX, toX, fromY, toY);
-          RenderPatch(info, lc_heights, lc_flags, noRipples, renderFlags == 1, m_verts, m_pVerts);
+          SPatchJob& job = m_patchJobs.emplace_back(SPatchJob{info, {}, renderFlags == 1});
+          PrepareRipples(info, rippleManager, fromX, toX, fromY, toY, job.rippleInfos);
+          if (m_patchJobs.size() == kPatchBatchSize) {
+            RenderPatchBatch(time, m_patchJobs, areaCenter);
+            m_patchJobs.clear();
+          }
         }
       }
       curX += ripplePitch.x();
@@ -867,6 +887,9 @@ void CFluidPlaneCPU::Render(const CStateManager& mgr, float alpha, const zeus::C
     tileY += CFluidPlaneRender::numTilesInHField;
   }
 
+  RenderPatchBatch(time, m_patchJobs, areaCenter);
+  m_patchJobs.clear();
+
   m_shader->loadVerts(m_verts, m_pVerts);
   m_shader->doneDrawing();
 }
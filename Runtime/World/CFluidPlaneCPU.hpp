@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "Runtime/GCNTypes.hpp"
 #include "Runtime/World/CFluidPlane.hpp"
@@ -60,8 +62,23 @@ protected:
   float x11c_unitsPerLightmapTexel;
   CTurbulence x120_turbulence;
 
+  /* A visible patch queued by Render, with the ripples that reach it */
+  struct SPatchJob {
+    CFluidPlaneRender::SPatchInfo info;
+    rstl::reserved_vector<CFluidPlaneRender::SRippleInfo, 32> rippleInfos;
+    bool flagIs1;
+  };
+  /* Height field for one patch of a batch; each job writes only its own */
+  struct SPatchScratch {
+    Heights heights;
+    Flags flags;
+  };
+  static constexpr size_t kPatchBatchSize = 16;
+
   u32 m_maxVertCount;
   bool m_tessellation = false;
+  std::vector<SPatchJob> m_patchJobs;
+  std::vector<std::unique_ptr<SPatchScratch>> m_patchScratch;
 
   bool m_cachedDoubleLightmapBlend = false;
   bool m_cachedAdditive = false;
@@ -76,9 +93,13 @@ protected:
                     Flags& flags, const SineTable& sineWave, const CFluidPlaneRender::SPatchInfo& info) const;
   static void UpdatePatchNoNormals(Heights& heights, const Flags& flags, const CFluidPlaneRender::SPatchInfo& info);
   static void UpdatePatchWithNormals(Heights& heights, const Flags& flags, const CFluidPlaneRender::SPatchInfo& info);
-  bool UpdatePatch(float time, const CFluidPlaneRender::SPatchInfo& info, Heights& heights, Flags& flags,
-                   const zeus::CVector3f& areaCenter, const std::optional<CRippleManager>& rippleManager, int fromX,
-                   int toX, int fromY, int toY) const;
+  static void PrepareRipples(const CFluidPlaneRender::SPatchInfo& info,
+                             const std::optional<CRippleManager>& rippleManager, int fromX, int toX, int fromY,
+                             int toY, rstl::reserved_vector<CFluidPlaneRender::SRippleInfo, 32>& rippleInfos);
+  void UpdatePatch(float time, const CFluidPlaneRender::SPatchInfo& info,
+                   const rstl::reserved_vector<CFluidPlaneRender::SRippleInfo, 32>& rippleInfos, Heights& heights,
+                   Flags& flags, const zeus::CVector3f& areaCenter) const;
+  void RenderPatchBatch(float time, std::span<const SPatchJob> jobs, const zeus::CVector3f& areaCenter);
 
 public:
   CFluidPlaneCPU(CAssetId texPattern1, CAssetId texPattern2, CAssetId texColor, CAssetId bumpMap, CAssetId envMap,
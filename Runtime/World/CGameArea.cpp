@@ -2,6 +2,8 @@
 
 #include <array>
 #include <cstring>
+#include <span>
+#include <vector>
 
 #include "Runtime/CGameState.hpp"
 #include "Runtime/CSimplePool.hpp"
@@ -9,6 +11,7 @@
 #include "Runtime/GameGlobalObjects.hpp"
 #include "Runtime/Graphics/CCubeRenderer.hpp"
 #include "Runtime/Graphics/CCubeSurface.hpp"
+#include "Runtime/Streams/CMemoryReader.hpp"
 #include "Runtime/World/CScriptAreaAttributes.hpp"
 
 #include "TCastTo.hpp" // Generated file, do not modify include path
@@ -18,22 +21,28 @@ namespace metaforce {
 static logvisor::Module Log("CGameArea");
 
 CAreaRenderOctTree::CAreaRenderOctTree(const u8* buf) : x0_buf(buf) {
-  CMemoryInStream r(x0_buf + 8, INT32_MAX);
+  CMemoryReader r(x0_buf + 8, 56);
   x8_bitmapCount = r.ReadLong();
   xc_meshCount = r.ReadLong();
   x10_nodeCount = r.ReadLong();
   x14_bitmapWordCount = (xc_meshCount + 31) / 32;
-  x18_aabb = r.Get<zeus::CAABox>();
+  x18_aabb = r.ReadAABox();
+  if (r.HasOverrun()) {
+    Log.report(logvisor::Fatal, FMT_STRING("Render octree header is truncated"));
+  }
 
   x30_bitmaps = reinterpret_cast<const u32*>(x0_buf + 64);
   u32 wc = x14_bitmapWordCount * x8_bitmapCount;
-  for (u32 i = 0; i < wc; ++i)
-    const_cast<u32*>(x30_bitmaps)[i] = CBasics::SwapBytes(x30_bitmaps[i]);
+  for (u32& word : std::span(const_cast<u32*>(x30_bitmaps), wc)) {
+    word = SBig(word);
+  }
 
   x34_indirectionTable = x30_bitmaps + wc;
   x38_entries = reinterpret_cast<const u8*>(x34_indirectionTable + x10_nodeCount);
+  for (u32& offset : std::span(const_cast<u32*>(x34_indirectionTable), x10_nodeCount)) {
+    offset = SBig(offset);
+  }
   for (u32 i = 0; i < x10_nodeCount; ++i) {
-    const_cast<u32*>(x34_indirectionTable)[i] = CBasics::SwapBytes(x34_indirectionTable[i]);
     Node* n = reinterpret_cast<Node*>(const_cast<u8*>(x38_entries) + x34_indirectionTable[i]);
     n->x0_bitmapIdx = CBasics::SwapBytes(n->x0_bitmapIdx);
     n->x2_flags = CBasics::SwapBytes(n->x2_flags);
@@ -683,20 +692,24 @@ bool CGameArea::StartStreamingMainArea() {
   case EPhase::LoadDataSections: {
     CullDeadAreaRequests();
 
+    std::vector<u32> secSizes(GetNumPartSizes());
+    CMemoryReader secSizesReader(x110_mreaSecBufs[1].first.get(), x110_mreaSecBufs[1].second);
+    secSizesReader.ReadArray<u32>(secSizes);
+    if (secSizesReader.HasOverrun()) {
+      Log.report(logvisor::Fatal, FMT_STRING("MREA section size table is truncated"));
+    }
     u32 totalSz = 0;
-    u32 secCount = GetNumPartSizes();
-    for (u32 i = 0; i < secCount; ++i)
-      totalSz += CBasics::SwapBytes(reinterpret_cast<u32*>(x110_mreaSecBufs[1].first.get())[i]);
+    for (u32 size : secSizes)
+      totalSz += size;
 
     AllocNewAreaData(x128_mreaDataOffset, totalSz);
 
-    m_resolvedBufs.reserve(secCount);
+    m_resolvedBufs.reserve(secSizes.size() + 2);
     m_resolvedBufs.emplace_back(x110_mreaSecBufs[0].first.get(), x110_mreaSecBufs[0].second);
     m_resolvedBufs.emplace_back(x110_mreaSecBufs[1].first.get(), x110_mreaSecBufs[1].second);
 
     u32 curOff = 0;
-    for (u32 i = 0; i < secCount; ++i) {
-      u32 size = CBasics::SwapBytes(reinterpret_cast<u32*>(x110_mreaSecBufs[1].first.get())[i]);
+    for (u32 size : secSizes) {
       m_resolvedBufs.emplace_back(x110_mreaSecBufs[2].first.get() + curOff, size);
       curOff += size;
     }
@@ -892,7 +905,11 @@ void CGameArea::PostConstructArea() {
   auto secIt = m_resolvedBufs.begin() + 3;
   x12c_postConstructed->x4c_insts.resize(header.modelCount);
   for (u32 i = 0; i < header.modelCount; ++i) {
-    u32 surfCount = CBasics::SwapBytes(*reinterpret_cast<const u32*>((secIt + 6)->first));
+    CMemoryReader r((secIt + 6)->first, (secIt + 6)->second);
+    u32 surfCount = r.ReadUint32();
+    if (r.HasOverrun()) {
+      Log.report(logvisor::Fatal, FMT_STRING("Surface count of model {} is truncated"), i);
+    }
     secIt += 7 + surfCount;
   }
 
@@ -944,19 +961,26 @@ void CGameArea::PostConstructArea() {
       x12c_postConstructed->x90_gfxLightsB = x12c_postConstructed->x70_gfxLightsA;
     }
 
+    /* CActorLights tests area lights against twice their radius */
+    x12c_postConstructed->m_lightGridA.Build(x12c_postConstructed->x70_gfxLightsA, 2.f);
+    x12c_postConstructed->m_lightGridB.Build(x12c_postConstructed->x90_gfxLightsB, 2.f);
+
     ++secIt;
   }
 
   /* PVS section */
   if (header.version > 7) {
-    CMemoryInStream r(secIt->first, secIt->second, CMemoryInStream::EOwnerShip::NotOwned);
-    if (secIt->second > 0) { // TODO this works around CMemoryInStream inf loop on 0 len
+    CMemoryReader r(secIt->first, secIt->second);
+    if (secIt->second > 0) {
       u32 magic = r.ReadLong();
       if (magic == 'VISI') {
         x12c_postConstructed->x10a8_pvsVersion = r.ReadLong();
         if (x12c_postConstructed->x10a8_pvsVersion == 2) {
           x12c_postConstructed->x1108_29_pvsHasActors = r.ReadBool();
           x12c_postConstructed->x1108_30_ = r.ReadBool();
+          if (r.HasOverrun()) {
+            Log.report(logvisor::Fatal, FMT_STRING("PVS header is truncated"));
+          }
           x12c_postConstructed->xa0_pvs =
               std::make_unique<CPVSAreaSet>(secIt->first + r.GetReadPosition(), secIt->second - r.GetReadPosition());
         }
@@ -987,18 +1011,20 @@ void CGameArea::PostConstructArea() {
 
   /* Resolve layer pointers */
   if (x12c_postConstructed->x10c8_sclyBuf != nullptr) {
-    CMemoryInStream r(x12c_postConstructed->x10c8_sclyBuf, x12c_postConstructed->x10d0_sclySize,
-                      CMemoryInStream::EOwnerShip::NotOwned);
-    FourCC magic;
-    r.Get(reinterpret_cast<u8*>(&magic), 4);
-    if (magic == FOURCC('SCLY')) {
+    CMemoryReader r(x12c_postConstructed->x10c8_sclyBuf, x12c_postConstructed->x10d0_sclySize);
+    u32 magic = r.ReadLong();
+    if (magic == 'SCLY') {
       r.ReadLong();
-      u32 layerCount = r.ReadLong();
-      x12c_postConstructed->x110c_layerPtrs.resize(layerCount);
-      for (u32 l = 0; l < layerCount; ++l)
-        x12c_postConstructed->x110c_layerPtrs[l].second = r.ReadLong();
-      const u8* ptr = x12c_postConstructed->x10c8_sclyBuf + r.GetReadPosition();
-      for (u32 l = 0; l < layerCount; ++l) {
+      std::vector<u32> layerSizes(r.ReadUint32());
+      r.ReadArray<u32>(layerSizes);
+      if (r.HasOverrun()) {
+        Log.report(logvisor::Fatal, FMT_STRING("SCLY layer size table is truncated"));
+      }
+      x12c_postConstructed->x110c_layerPtrs.resize(layerSizes.size());
+      for (size_t l = 0; l < layerSizes.size(); ++l)
+        x12c_postConstructed->x110c_layerPtrs[l].second = layerSizes[l];
+      const u8* ptr = r.GetCurrentPtr();
+      for (size_t l = 0; l < layerSizes.size(); ++l) {
         x12c_postConstructed->x110c_layerPtrs[l].first = ptr;
         ptr += x12c_postConstructed->x110c_layerPtrs[l].second;
       }
@@ -1088,7 +1114,7 @@ SMREAHeader CGameArea::VerifyHeader() const {
     return {};
   }
 
-  CMemoryInStream r(x110_mreaSecBufs[0].first.get() + 4, x110_mreaSecBufs[0].second - 4);
+  CMemoryReader r(x110_mreaSecBufs[0].first.get() + 4, x110_mreaSecBufs[0].second - 4);
   u32 version = r.ReadLong();
   if ((version & 0x10000) != 0) {
     Log.report(logvisor::Fatal, FMT_STRING("Attempted to load non-retail MREA"));
@@ -1100,7 +1126,7 @@ SMREAHeader CGameArea::VerifyHeader() const {
     return {};
   }
 
-  header.xf = r.Get<zeus::CTransform>();
+  header.xf = r.ReadTransform();
   header.modelCount = r.ReadLong();
   header.secCount = r.ReadLong();
   header.geomSecIdx = r.ReadLong();
@@ -1111,6 +1137,9 @@ SMREAHeader CGameArea::VerifyHeader() const {
   header.visiSecIdx = r.ReadLong();
   header.pathSecIdx = r.ReadLong();
   header.arotSecIdx = r.ReadLong();
+  if (r.HasOverrun()) {
+    Log.report(logvisor::Fatal, FMT_STRING("MREA header is truncated"));
+  }
 
   return header;
 }
@@ -7,6 +7,7 @@
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/Collision/CAreaOctTree.hpp"
 #include "Runtime/Graphics/CGraphics.hpp"
+#include "Runtime/Graphics/CLightGrid.hpp"
 #include "Runtime/Graphics/CMetroidModelInstance.hpp"
 #include "Runtime/Graphics/CModel.hpp"
 #include "Runtime/Graphics/CPVSAreaSet.hpp"
@@ -207,6 +208,9 @@ public:
     std::vector<CLight> x70_gfxLightsA;
     std::vector<CWorldLight> x80_lightsB;
     std::vector<CLight> x90_gfxLightsB;
+    /* Built from the gfx lights above, for CActorLights candidate lookup */
+    CLightGrid m_lightGridA;
+    CLightGrid m_lightGridB;
     std::unique_ptr<CPVSAreaSet> xa0_pvs;
     u32 xa4_elemCount = kMaxEntities;
     struct MapEntry {
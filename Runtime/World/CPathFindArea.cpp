@@ -1,5 +1,7 @@
 #include "Runtime/World/CPathFindArea.hpp"
 
+#include <algorithm>
+
 #include <logvisor/logvisor.hpp>
 
 #include "Runtime/CToken.hpp"
@@ -122,6 +124,25 @@ void CPFOpenList::Pop(CPFRegion* reg) {
 
 bool CPFOpenList::Test(const CPFRegion* reg) const { return x0_bitSet.Test(reg->GetIndex()); }
 
+const std::vector<u16>* CPFRouteCache::Find(const SPFRouteKey& key) {
+  for (SEntry& entry : m_entries) {
+    if (entry.key == key) {
+      entry.lastUse = ++m_useCounter;
+      return &entry.route;
+    }
+  }
+  return nullptr;
+}
+
+void CPFRouteCache::Insert(const SPFRouteKey& key, const std::vector<u16>& route) {
+  /* Evict the least recently used entry; empty ones have never been used */
+  SEntry& entry = *std::min_element(m_entries.begin(), m_entries.end(),
+                                    [](const SEntry& a, const SEntry& b) { return a.lastUse < b.lastUse; });
+  entry.key = key;
+  entry.route.assign(route.begin(), route.end());
+  entry.lastUse = ++m_useCounter;
+}
+
 CPFArea::CPFArea(std::unique_ptr<u8[]>&& buf, u32 len) {
   CMemoryInStream r(buf.get(), len);
 
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <array>
 #include <bitset>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "Runtime/IFactory.hpp"
@@ -60,6 +62,36 @@ public:
   bool Test(const CPFRegion* reg) const;
 };
 
+/* Single source and destination region a route was resolved to, plus the filters it ran with */
+struct SPFRouteKey {
+  u16 srcRegion;
+  u16 dstRegion;
+  u32 flags;
+  u32 indexMask;
+
+  bool operator==(const SPFRouteKey&) const = default;
+};
+
+/* Region routes found by earlier A* searches, so agents whose points fall in exactly the regions a route
+ * was resolved to skip the search and only redo their own string pulling. Searches that could start or end
+ * in several regions still run A*, since which of them wins depends on the points. The region graph never
+ * changes once the area is loaded, so entries stay valid until evicted and the cache goes away with its area. */
+class CPFRouteCache {
+  static constexpr size_t kNumEntries = 32;
+  struct SEntry {
+    std::optional<SPFRouteKey> key;
+    std::vector<u16> route;
+    u32 lastUse = 0;
+  };
+  std::array<SEntry, kNumEntries> m_entries;
+  u32 m_useCounter = 0;
+
+public:
+  /* Route as region indices from source to destination, or nullptr */
+  const std::vector<u16>* Find(const SPFRouteKey& key);
+  void Insert(const SPFRouteKey& key, const std::vector<u16>& route);
+};
+
 class CPFArea {
   friend class CPFRegion;
   friend class CPFAreaOctree;
@@ -88,6 +120,8 @@ class CPFArea {
   std::vector<u32> x170_connectionsFlyers;         // x170: word_count, x174: ptr
   std::vector<CPFRegionData> x178_regionDatas;
   zeus::CTransform x188_transform;
+  CPFRouteCache m_routeCache;
+  std::vector<u16> m_routeScratch;
 
 public:
   CPFArea(std::unique_ptr<u8[]>&& buf, u32 len);
@@ -98,6 +132,7 @@ public:
   const zeus::CVector3f& GetClosestPoint() const { return x4_closestPoint; }
   CPFOpenList& OpenList() { return x78_openList; }
   CPFBitSet& ClosedSet() { return x38_closedSet; }
+  CPFRouteCache& RouteCache() { return m_routeCache; }
   const CPFRegionData& GetRegionData(s32 i) const { return x178_regionDatas[i]; }
   const CPFLink& GetLink(s32 i) const { return x148_links[i]; }
   const CPFNode& GetNode(s32 i) const { return x140_nodes[i]; }
@@ -176,17 +176,18 @@ bool CPFRegion::FindBestPoint(std::vector<zeus::CVector3f>& polyPoints, const ze
   return found;
 }
 
-void CPFRegion::SetLinkTo(u32 idx) {
+bool CPFRegion::SetLinkTo(u32 idx) {
   if (x8_numLinks <= 0) {
-    return;
+    return false;
   }
 
   for (u32 i = 0; i < x8_numLinks; ++i) {
     if (xc_startLink[i].GetRegion() == idx) {
       Data()->SetPathLink(i);
-      return;
+      return true;
     }
   }
+  return false;
 }
 
 void CPFRegion::DropToGround(zeus::CVector3f& point) const {
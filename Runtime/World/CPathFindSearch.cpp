@@ -1,5 +1,7 @@
 #include "Runtime/World/CPathFindSearch.hpp"
 
+#include <algorithm>
+
 #include "Runtime/Graphics/CGraphics.hpp"
 
 namespace metaforce {
@@ -182,20 +184,62 @@ CPathFindSearch::EResult CPathFindSearch::Search(const zeus::CVector3f& p1, cons
     }
   }
 
-  /* Perform A* algorithm if path is known to exist */
-  if (noPath || !Search(regions1Uniq, localP1, regions2Uniq, localP2)) {
+  if (noPath) {
     xcc_result = EResult::NoPath;
     return xcc_result;
   }
 
-  /* Set forward links with best path */
-  CPFRegion* reg = regions2Uniq[0];
-  u32 lastPoint = 0;
-  do {
-    reg->Data()->GetParent()->SetLinkTo(reg->GetIndex());
-    reg = reg->Data()->GetParent();
-    ++lastPoint;
-  } while (reg != regions1Uniq[0]);
+  /* Region route from source to destination */
+  std::vector<u16>& route = x0_area->m_routeScratch;
+  const auto searchRoute = [&] {
+    /* Perform A* algorithm if path is known to exist */
+    if (!Search(regions1Uniq, localP1, regions2Uniq, localP2)) {
+      return false;
+    }
+    route.clear();
+    for (CPFRegion* r = regions2Uniq[0]; r != regions1Uniq[0]; r = r->Data()->GetParent()) {
+      route.push_back(u16(r->GetIndex()));
+    }
+    route.push_back(u16(regions1Uniq[0]->GetIndex()));
+    std::reverse(route.begin(), route.end());
+    return true;
+  };
+  const auto setPathLinks = [&] {
+    for (size_t i = 0; i + 1 < route.size(); ++i) {
+      if (!x0_area->x150_regions[route[i]].SetLinkTo(route[i + 1])) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  bool searched = false;
+  const std::vector<u16>* cached = nullptr;
+  if (regions1Uniq.size() == 1 && regions2Uniq.size() == 1) {
+    cached = x0_area->RouteCache().Find(
+        {u16(regions1Uniq[0]->GetIndex()), u16(regions2Uniq[0]->GetIndex()), xdc_flags, xe0_indexMask});
+  }
+  if (cached != nullptr) {
+    route.assign(cached->begin(), cached->end());
+  } else {
+    if (!searchRoute()) {
+      xcc_result = EResult::NoPath;
+      return xcc_result;
+    }
+    searched = true;
+    /* Stored under the regions A* settled on, which is all a later single-region lookup can match */
+    x0_area->RouteCache().Insert({route.front(), route.back(), xdc_flags, xe0_indexMask}, route);
+  }
+
+  /* Set forward links with best path. A reused route that doesn't follow the forward links would leave
+   * stale path links behind, so redo the search instead. */
+  if (!setPathLinks() && (searched || !searchRoute() || !setPathLinks())) {
+    xcc_result = EResult::NoPath;
+    return xcc_result;
+  }
+  CPFRegion* srcRegion = &x0_area->x150_regions[route.front()];
+  CPFRegion* dstRegion = &x0_area->x150_regions[route.back()];
+  u32 lastPoint = u32(route.size()) - 1;
 
   /* Setup point range */
   bool includeP2 = true;
@@ -209,14 +253,14 @@ CPathFindSearch::EResult CPathFindSearch::Search(const zeus::CVector3f& p1, cons
 
   /* Ensure start and finish points are on ground */
   if (!(xdc_flags & 0x2) && !(xdc_flags & 0x4)) {
-    regions1Uniq[0]->DropToGround(localP1);
-    regions2Uniq[0]->DropToGround(localP2);
+    srcRegion->DropToGround(localP1);
+    dstRegion->DropToGround(localP2);
   }
 
   /* Gather link points using midpoints */
   float chHalfHeight = 0.5f * xd0_chHeight;
   points.push_back(localP1);
-  reg = regions1Uniq[0];
+  CPFRegion* reg = srcRegion;
   for (u32 i = firstPoint; i <= lastPoint; ++i) {
     const CPFLink* link = reg->GetPathLink();
     CPFRegion* linkReg = &x0_area->x150_regions[link->GetRegion()];
@@ -238,7 +282,7 @@ CPathFindSearch::EResult CPathFindSearch::Search(const zeus::CVector3f& p1, cons
 
   /* Optimize link points using character radius and height */
   for (int i = 0; i < 2; ++i) {
-    reg = regions1Uniq[0];
+    reg = srcRegion;
     for (u32 j = firstPoint; j <= (includeP2 ? lastPoint : lastPoint - 1); ++j) {
       const CPFLink* link = reg->GetPathLink();
       CPFRegion* linkReg = &x0_area->x150_regions[link->GetRegion()];
@@ -173,9 +173,9 @@ void CSnakeWeedSwarm::Touch(CActor& actor, CStateManager& mgr) {
     }
   }
   if (TCastToPtr<CPlayer> player = actor) {
-    for (const auto& boid : x134_boids) {
-      float m = (boid.GetPosition() - player->GetTransform().origin).magnitude();
-      if (m < x104_maxPlayerDistance && boid.GetState() == EBoidState::Raised) {
+    m_boidHash.FindInRadius(player->GetTransform().origin, x104_maxPlayerDistance, m_nearBoids);
+    for (const u32 idx : m_nearBoids) {
+      if (x134_boids[idx].GetState() == EBoidState::Raised) {
         mgr.SendScriptMsg(player, kInvalidUniqueId, EScriptObjectMessage::InSnakeWeed);
         x140_26_playerTouching = true;
       }
@@ -184,11 +184,11 @@ void CSnakeWeedSwarm::Touch(CActor& actor, CStateManager& mgr) {
 }
 
 void CSnakeWeedSwarm::HandleRadiusDamage(float radius, CStateManager& mgr, const zeus::CVector3f& pos) {
-  float radiusSquared = radius * radius;
-  for (auto& boid : x134_boids) {
+  m_boidHash.FindInRadius(pos, radius, m_nearBoids);
+  for (const u32 idx : m_nearBoids) {
+    auto& boid = x134_boids[idx];
     const auto& boidPosition = boid.GetPosition();
-    if ((boidPosition - pos).magSquared() < radiusSquared &&
-        (boid.GetState() == EBoidState::Raised || boid.GetState() == EBoidState::Raising)) {
+    if (boid.GetState() == EBoidState::Raised || boid.GetState() == EBoidState::Raising) {
       boid.SetState(EBoidState::Lowering);
       boid.SetSpeed(x118_speedVariation * mgr.GetActiveRandom()->Float() + x114_speed);
       CSfxManager::AddEmitter(x1d2_sfx2, boidPosition, zeus::skZero3f, true, false, 0x7f, x4_areaId);
@@ -385,6 +385,11 @@ void CSnakeWeedSwarm::CalculateTouchBounds() {
       x144_touchBounds.accumulateBounds(boid.GetPosition() + x100_weaponDamageRadius);
     }
   }
+  m_boidHash.Clear();
+  for (u32 i = 0; i < x134_boids.size(); ++i) {
+    m_boidHash.Add(x134_boids[i].GetPosition(), zeus::skZero3f, i);
+  }
+  m_boidHash.Build(std::max(x100_weaponDamageRadius, x104_maxPlayerDistance));
   xe4_27_notInSortedLists = true;
 }
 
@@ -3,6 +3,7 @@
 #include "Runtime/Collision/CCollisionSurface.hpp"
 #include "Runtime/Particle/CElementGen.hpp"
 #include "Runtime/World/CActor.hpp"
+#include "Runtime/World/CBoidSpatialHash.hpp"
 #include "Runtime/World/CDamageInfo.hpp"
 
 namespace metaforce {
@@ -91,6 +92,9 @@ private:
   u32 x1fc_;
   float x200_; // unused?
   float x204_particleTimer = 0.f;
+  /* Weeds never move, so this is only rebuilt when more are placed */
+  CBoidSpatialHash m_boidHash;
+  std::vector<u32> m_nearBoids;
 
 public:
   DEFINE_ENTITY
@@ -350,45 +350,18 @@ void CWallCrawlerSwarm::SetExplodeTimers(const zeus::CVector3f& pos, float radiu
   }
 }
 
-CWallCrawlerSwarm::CBoid* CWallCrawlerSwarm::GetListAt(const zeus::CVector3f& pos) {
-  const zeus::CAABox aabb = GetBoundingBox();
-  const zeus::CVector3f ints = (pos - aabb.min) / ((aabb.max - aabb.min) / 5.f);
-  const int idx = int(ints.x()) + int(ints.y()) * 5 + int(ints.z()) * 25;
-  if (idx < 0 || idx >= 125) {
-    return x360_outlierBoidList;
-  }
-  return x168_partitionedBoidLists[idx];
-}
-
-void CWallCrawlerSwarm::BuildBoidNearList(const CBoid& boid, float radius,
-                                          rstl::reserved_vector<CBoid*, 50>& nearList) {
-  CBoid* b = GetListAt(boid.GetTranslation());
-  while (b && nearList.size() < 50) {
-    const float distSq = (b->GetTranslation() - boid.GetTranslation()).magSquared();
-    if (distSq != 0.f && distSq < radius) {
-      nearList.push_back(b);
-    }
-    b = b->x44_next;
-  }
+SBoidNeighbourhood CWallCrawlerSwarm::GatherNeighbours(const CBoid& boid) const {
+  /* The original near list compared squared distances against the unsquared separation radius */
+  return m_boidHash.Gather(boid.GetTranslation(), std::sqrt(std::max(x13c_separationRadius, 0.f)), 50);
 }
 
-void CWallCrawlerSwarm::ApplySeparation(const CBoid& boid, const rstl::reserved_vector<CBoid*, 50>& nearList,
+void CWallCrawlerSwarm::ApplySeparation(const CBoid& boid, const SBoidNeighbourhood& neighbours,
                                         zeus::CVector3f& aheadVec) const {
-  if (nearList.empty()) {
+  if (neighbours.empty()) {
     return;
   }
 
-  float minDist = FLT_MAX;
-  zeus::CVector3f pos;
-  for (const CBoid* b : nearList) {
-    const float dist = (boid.GetTranslation() - b->GetTranslation()).magSquared();
-    if (dist != 0.f && dist < minDist) {
-      minDist = dist;
-      pos = b->GetTranslation();
-    }
-  }
-
-  ApplySeparation(boid, pos, x13c_separationRadius, x148_separationMagnitude, aheadVec);
+  ApplySeparation(boid, neighbours.nearestPos, x13c_separationRadius, x148_separationMagnitude, aheadVec);
 }
 
 void CWallCrawlerSwarm::ApplySeparation(const CBoid& boid, const zeus::CVector3f& separateFrom, float separationRadius,
@@ -440,19 +413,13 @@ void CWallCrawlerSwarm::MoveToWayPoint(CBoid& boid, CStateManager& mgr, zeus::CV
   }
 }
 
-void CWallCrawlerSwarm::ApplyCohesion(const CBoid& boid, const rstl::reserved_vector<CBoid*, 50>& nearList,
+void CWallCrawlerSwarm::ApplyCohesion(const CBoid& boid, const SBoidNeighbourhood& neighbours,
                                       zeus::CVector3f& aheadVec) const {
-  if (nearList.empty()) {
+  if (neighbours.empty()) {
     return;
   }
 
-  zeus::CVector3f avg;
-  for (const CBoid* b : nearList) {
-    avg += b->GetTranslation();
-  }
-
-  avg = avg / float(nearList.size());
-  ApplyCohesion(boid, avg, x13c_separationRadius, x140_cohesionMagnitude, aheadVec);
+  ApplyCohesion(boid, neighbours.AveragePos(), x13c_separationRadius, x140_cohesionMagnitude, aheadVec);
 }
 
 void CWallCrawlerSwarm::ApplyCohesion(const CBoid& boid, const zeus::CVector3f& cohesionFrom, float cohesionRadius,
@@ -467,18 +434,13 @@ void CWallCrawlerSwarm::ApplyCohesion(const CBoid& boid, const zeus::CVector3f&
   aheadVec += ((distSq > capDistSq) ? 1.f : distSq / capDistSq) * delta.normalized() * cohesionMagnitude;
 }
 
-void CWallCrawlerSwarm::ApplyAlignment(const CBoid& boid, const rstl::reserved_vector<CBoid*, 50>& nearList,
+void CWallCrawlerSwarm::ApplyAlignment(const CBoid& boid, const SBoidNeighbourhood& neighbours,
                                        zeus::CVector3f& aheadVec) const {
-  if (nearList.empty()) {
+  if (neighbours.empty()) {
     return;
   }
 
-  zeus::CVector3f avg;
-  for (const CBoid* b : nearList) {
-    avg += b->GetTransform().basis[1];
-  }
-
-  avg = avg / float(nearList.size());
+  const zeus::CVector3f avg = neighbours.AverageHeading();
   aheadVec += zeus::CVector3f::getAngleDiff(boid.GetTransform().basis[1], avg) / M_PIF * (avg * x144_alignmentWeight);
 }
 
@@ -565,8 +527,7 @@ void CWallCrawlerSwarm::UpdateBoid(const CAreaCollisionCache& ccache, CStateMana
                              .multiplyIgnoreTranslation(boid.GetTransform());
       boid.x7c_framesNotOnSurface += 1;
     }
-    rstl::reserved_vector<CBoid*, 50> nearList;
-    BuildBoidNearList(boid, x13c_separationRadius, nearList);
+    const SBoidNeighbourhood neighbours = GatherNeighbours(boid);
     zeus::CVector3f aheadVec = boid.GetTransform().basis[1] * 0.3f;
     for (int r26 = 0; r26 < 8; ++r26) {
       switch (r26) {
@@ -578,16 +539,16 @@ void CWallCrawlerSwarm::UpdateBoid(const CAreaCollisionCache& ccache, CStateMana
         }
         break;
       case 4:
-        ApplySeparation(boid, nearList, aheadVec);
+        ApplySeparation(boid, neighbours, aheadVec);
         break;
       case 5:
         MoveToWayPoint(boid, mgr, aheadVec);
         break;
       case 6:
-        ApplyCohesion(boid, nearList, aheadVec);
+        ApplyCohesion(boid, neighbours, aheadVec);
         break;
       case 7:
-        ApplyAlignment(boid, nearList, aheadVec);
+        ApplyAlignment(boid, neighbours, aheadVec);
         break;
       case 3:
         ApplyAttraction(boid, mgr.GetPlayer().GetTranslation(), x154_attractionRadius, x150_attractionMagnitude,
@@ -695,6 +656,14 @@ void CWallCrawlerSwarm::UpdatePartition() {
       }
     }
   }
+
+  m_boidHash.Clear();
+  for (const auto& b : x108_boids) {
+    if (b.GetActive()) {
+      m_boidHash.Add(b.GetTranslation(), b.GetTransform().basis[1], u32(b.x7c_idx));
+    }
+  }
+  m_boidHash.Build(std::sqrt(std::max(x13c_separationRadius, 0.f)));
 }
 
 zeus::CVector3f CWallCrawlerSwarm::FindClosestCell(const zeus::CVector3f& pos) const {
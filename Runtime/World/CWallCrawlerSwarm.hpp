@@ -9,6 +9,7 @@
 #include "Runtime/Collision/CCollisionSurface.hpp"
 #include "Runtime/Particle/CElementGen.hpp"
 #include "Runtime/World/CActor.hpp"
+#include "Runtime/World/CBoidSpatialHash.hpp"
 #include "Runtime/World/CDamageInfo.hpp"
 #include "Runtime/World/CDamageVulnerability.hpp"
 
@@ -83,6 +84,8 @@ private:
   float x164_waypointGoalRadius = 3.f;
   rstl::reserved_vector<CBoid*, 125> x168_partitionedBoidLists;
   CBoid* x360_outlierBoidList = nullptr;
+  /* Neighbour queries for the flocking rules; the partition above still drives collision and rendering */
+  CBoidSpatialHash m_boidHash;
   float x364_boidGenRate;
   float x368_boidGenCooldownTimer = 0.f;
   float x36c_crabDamageCooldownTimer = 0.f;
@@ -136,20 +139,16 @@ private:
   void CreateBoid(CStateManager& mgr, int idx);
   void ExplodeBoid(CBoid& boid, CStateManager& mgr);
   void SetExplodeTimers(const zeus::CVector3f& pos, float radius, float minTime, float maxTime);
-  CBoid* GetListAt(const zeus::CVector3f& pos);
-  void BuildBoidNearList(const CBoid& boid, float radius, rstl::reserved_vector<CBoid*, 50>& nearList);
-  void ApplySeparation(const CBoid& boid, const rstl::reserved_vector<CBoid*, 50>& nearList,
-                       zeus::CVector3f& aheadVec) const;
+  SBoidNeighbourhood GatherNeighbours(const CBoid& boid) const;
+  void ApplySeparation(const CBoid& boid, const SBoidNeighbourhood& neighbours, zeus::CVector3f& aheadVec) const;
   void ApplySeparation(const CBoid& boid, const zeus::CVector3f& separateFrom, float separationRadius,
                        float separationMagnitude, zeus::CVector3f& aheadVec) const;
   void ScatterScarabBoid(CBoid& boid, CStateManager& mgr) const;
   void MoveToWayPoint(CBoid& boid, CStateManager& mgr, zeus::CVector3f& aheadVec) const;
-  void ApplyCohesion(const CBoid& boid, const rstl::reserved_vector<CBoid*, 50>& nearList,
-                     zeus::CVector3f& aheadVec) const;
+  void ApplyCohesion(const CBoid& boid, const SBoidNeighbourhood& neighbours, zeus::CVector3f& aheadVec) const;
   void ApplyCohesion(const CBoid& boid, const zeus::CVector3f& cohesionFrom, float cohesionRadius,
                      float cohesionMagnitude, zeus::CVector3f& aheadVec) const;
-  void ApplyAlignment(const CBoid& boid, const rstl::reserved_vector<CBoid*, 50>& nearList,
-                      zeus::CVector3f& aheadVec) const;
+  void ApplyAlignment(const CBoid& boid, const SBoidNeighbourhood& neighbours, zeus::CVector3f& aheadVec) const;
   void ApplyAttraction(const CBoid& boid, const zeus::CVector3f& attractTo, float attractionRadius,
                        float attractionMagnitude, zeus::CVector3f& aheadVec) const;
   void UpdateBoid(const CAreaCollisionCache& ccache, CStateManager& mgr, float dt, CBoid& boid);